@@ -0,0 +1,182 @@
+/**
+ * @file   bench_chan.cpp
+ * @author agent <agent@local>
+ * @date   Sun Oct 18 14:33:58 2026
+ *
+ * @brief  Channel benchmark against mutex and condition variable.
+ *
+ * Channel runs producer and consumer coroutines in one thread. It is
+ * compared to the same schedule with a mutex protected queue (cost
+ * per operation, without wakeups), and to a blocking queue with
+ * producer and consumer threads (mutex and condition variables).
+ *
+ * Build and run:
+ *
+ *     shell> gcc -O2 -c src/ringer.c src/ringer_chan.c
+ *     shell> g++ -std=c++20 -O2 -Isrc bench/bench_chan.cpp ringer.o ringer_chan.o -lpthread
+ *     shell> ./a.out
+ *
+ */
+
+#include <chrono>
+#include <condition_variable>
+#include <coroutine>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+
+#include "ringer_chan.hpp"
+
+
+static const int bench_items = 10000000;
+static const int bench_size = 256;
+
+
+/* Eagerly started coroutine, frame is released at completion. */
+struct task
+{
+    struct promise_type
+    {
+        task get_return_object() { return {}; }
+        std::suspend_never initial_suspend() { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() { std::abort(); }
+    };
+};
+
+
+static task producer( ringer::channel<int>& ch, int* items )
+{
+    for ( int i = 0; i < bench_items; i++ )
+        co_await ch.push( &items[ i & 1 ] );
+    ch.close();
+}
+
+
+static task consumer( ringer::channel<int>& ch, long* sum )
+{
+    while ( int* item = co_await ch.pop() )
+        *sum += *item;
+}
+
+
+static double bench_channel( long* sum )
+{
+    ringer::channel<int> ch( bench_size );
+    int                  items[ 2 ] = { 1, 2 };
+
+    auto start = std::chrono::steady_clock::now();
+    consumer( ch, sum );
+    producer( ch, items );
+    auto stop = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::nano>( stop - start ).count();
+}
+
+
+/* Baseline: Ringer protected with mutex and condition variables. */
+struct locked_queue
+{
+    std::mutex              mutex;
+    std::condition_variable not_empty;
+    std::condition_variable not_full;
+    rg_t                    rg = rg_new( bench_size );
+
+    ~locked_queue() { rg_destroy( &rg ); }
+
+    bool try_push( int* item )
+    {
+        std::lock_guard<std::mutex> lock( mutex );
+        if ( !rg_put( rg, item ) )
+            return false;
+        not_empty.notify_one();
+        return true;
+    }
+
+    int* try_pop()
+    {
+        std::lock_guard<std::mutex> lock( mutex );
+        int* item = static_cast<int*>( rg_get( rg ) );
+        if ( item )
+            not_full.notify_one();
+        return item;
+    }
+
+    void push( int* item )
+    {
+        std::unique_lock<std::mutex> lock( mutex );
+        not_full.wait( lock, [this] { return !rg_is_full( rg ); } );
+        rg_put( rg, item );
+        not_empty.notify_one();
+    }
+
+    /* Null item is the end marker. */
+    int* pop()
+    {
+        std::unique_lock<std::mutex> lock( mutex );
+        not_empty.wait( lock, [this] { return rg_count( rg ) > 0; } );
+        int* item = static_cast<int*>( rg_get( rg ) );
+        not_full.notify_one();
+        return item;
+    }
+};
+
+
+/* Same schedule as Channel: fill until full, then drain until empty. */
+static double bench_mutex( long* sum )
+{
+    locked_queue q;
+    int          items[ 2 ] = { 1, 2 };
+    int          i = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    while ( i < bench_items ) {
+        while ( i < bench_items && q.try_push( &items[ i & 1 ] ) )
+            i++;
+        while ( int* item = q.try_pop() )
+            *sum += *item;
+    }
+    auto stop = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::nano>( stop - start ).count();
+}
+
+
+/* Producer and consumer threads, blocking on full and empty. */
+static double bench_condvar( long* sum )
+{
+    locked_queue q;
+    int          items[ 2 ] = { 1, 2 };
+
+    auto        start = std::chrono::steady_clock::now();
+    std::thread consumer( [&q, sum] {
+        while ( int* item = q.pop() )
+            *sum += *item;
+    } );
+    for ( int i = 0; i < bench_items; i++ )
+        q.push( &items[ i & 1 ] );
+    q.push( nullptr );
+    consumer.join();
+    auto stop = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::nano>( stop - start ).count();
+}
+
+
+int main( void )
+{
+    long   sum1 = 0;
+    long   sum2 = 0;
+    long   sum3 = 0;
+    double t1 = bench_channel( &sum1 );
+    double t2 = bench_mutex( &sum2 );
+    double t3 = bench_condvar( &sum3 );
+
+    std::printf( "channel:             %6.2f ns/item (sum %ld)\n", t1 / bench_items, sum1 );
+    std::printf( "mutex (one thread):  %6.2f ns/item (sum %ld)\n", t2 / bench_items, sum2 );
+    std::printf( "mutex+condvar (2 t): %6.2f ns/item (sum %ld)\n", t3 / bench_items, sum3 );
+
+    return ( sum1 == sum2 && sum1 == sum3 ) ? 0 : 1;
+}
@@ -0,0 +1,103 @@
+/**
+ * @file   bench_fc.c
+ * @author agent <agent@local>
+ * @date   Sun Oct 18 14:39:53 2026
+ *
+ * @brief  Combining Ringer benchmark against mutex per operation.
+ *
+ * Build and run:
+ *
+ *     shell> gcc -O2 -Isrc bench/bench_fc.c src/ringer.c src/ringer_fc.c -lpthread
+ *     shell> ./a.out [threads]
+ *
+ */
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "ringer_fc.h"
+
+
+static const int bench_ops = 2000000;
+static const int bench_size = 1024;
+
+
+static rgfc_t          fc;
+static rg_t            rg;
+static pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+
+
+/* Mixed deque operations through Combining Ringer. */
+static void* bench_fc( void* arg )
+{
+    (void)arg;
+
+    for ( int i = 0; i < bench_ops; i++ ) {
+        switch ( i % 4 ) {
+            case 0: rgfc_put( fc, &fc ); break;
+            case 1: rgfc_put_front( fc, &fc ); break;
+            case 2: rgfc_get_back( fc ); break;
+            case 3: rgfc_get_nth( fc, 0 ); break;
+        }
+    }
+
+    return NULL;
+}
+
+
+/* Mixed deque operations through mutex. */
+static void* bench_mutex( void* arg )
+{
+    (void)arg;
+
+    for ( int i = 0; i < bench_ops; i++ ) {
+        pthread_mutex_lock( &mutex );
+        switch ( i % 4 ) {
+            case 0: rg_put( rg, &rg ); break;
+            case 1: rg_put_front( rg, &rg ); break;
+            case 2: rg_get_back( rg ); break;
+            case 3: rg_get_nth( rg, 0 ); break;
+        }
+        pthread_mutex_unlock( &mutex );
+    }
+
+    return NULL;
+}
+
+
+static double bench_run( void* ( *fn )( void* ), int threads )
+{
+    pthread_t       thr[ threads ];
+    struct timespec t0, t1;
+
+    clock_gettime( CLOCK_MONOTONIC, &t0 );
+
+    for ( int i = 0; i < threads; i++ )
+        pthread_create( &thr[ i ], NULL, fn, NULL );
+    for ( int i = 0; i < threads; i++ )
+        pthread_join( thr[ i ], NULL );
+
+    clock_gettime( CLOCK_MONOTONIC, &t1 );
+
+    return ( ( t1.tv_sec - t0.tv_sec ) * 1e9 + ( t1.tv_nsec - t0.tv_nsec ) ) / ( (double)bench_ops * threads );
+}
+
+
+int main( int argc, char** argv )
+{
+    int threads = ( argc > 1 ) ? atoi( argv[ 1 ] ) : 8;
+
+    fc = rgfc_new( bench_size, threads );
+    rg = rg_new( bench_size );
+
+    printf( "threads:   %d\n", threads );
+    printf( "combining: %6.1f ns/op\n", bench_run( bench_fc, threads ) );
+    printf( "mutex:     %6.1f ns/op\n", bench_run( bench_mutex, threads ) );
+
+    rgfc_destroy( &fc );
+    rg_destroy( &rg );
+
+    return 0;
+}
@@ -8,6 +8,7 @@
  */
 
 #include <string.h>
+#include <time.h>
 #include "ringer.h"
 
 
@@ -19,14 +20,56 @@ const char* rg_version = "0.0.1";
 /** @cond ringer_none */
 #define rg_true  1
 #define rg_false 0
-#define rg_struct_size(size) ( sizeof(rg_s) + size*sizeof(void*) )
+#define rg_struct_size(size) ( sizeof(rg_ext_t) + sizeof(rg_s) + size*sizeof(void*) )
 #define rg_unit_size         ( sizeof( void* ) )
+#define rg_base( rg )        ( (rg_ext_t*)( rg ) - 1 )
+#define rg_ext( rg )         ( *rg_base( rg ) )
 #define rg_nth( rg, pos )    rg->data[ ( pos ) ]
+#define rg_stamped( rg )     ( rg_ext( rg ) && rg_ext( rg )->stamp )
+#ifdef __GNUC__
+#define rg_prefetch( ptr )   __builtin_prefetch( ( ptr ) )
+#else
+#define rg_prefetch( ptr )
+#endif
 /** @endcond ringer_none */
 
 /* clang-format on */
 
 
+/**
+ * Ringer extension.
+ *
+ * Extension pointer is stored in a slot just before the Ringer
+ * header, within the same allocation. Hence Ringer struct layout is
+ * not affected by optional features, and the pointer shares the cache
+ * line with the header.
+ */
+struct rg_ext_s
+{
+    rg_size_t     lo;        /**< Low watermark. */
+    rg_size_t     hi;        /**< High watermark. */
+    rg_mark_fn_t  fn;        /**< Watermark callback. */
+    void*         ctx;       /**< Watermark callback context. */
+    int           above;     /**< High watermark passed (and low not). */
+    rg_size_t*    stamp;     /**< Put times, parallel to data (or NULL). */
+    rg_dwell_fn_t dwell;     /**< Dwell time callback. */
+    void*         dwell_ctx; /**< Dwell time callback context. */
+};
+typedef struct rg_ext_s rg_ext_s;
+typedef rg_ext_s*        rg_ext_t;
+
+
+static rg_ext_t rg_ext_get( rg_t rg );
+static void rg_ext_release( rg_t rg );
+static void rg_ext_update( rg_t rg );
+static void rg_on_put( rg_t rg, rg_size_t idx );
+static void rg_on_get( rg_t rg, rg_size_t idx );
+static rg_size_t rg_now( void );
+static void rg_stamp_put( rg_t rg, rg_size_t idx );
+static void rg_stamp_get( rg_t rg, rg_size_t idx );
+static void rg_move( rg_t rg, rg_size_t dst, rg_size_t src, rg_size_t n );
+static void rg_copy( rg_t dst, rg_size_t didx, rg_t src, rg_size_t sidx, rg_size_t n );
+static rg_size_t rg_splice_count( rg_t dst, rg_t src, rg_size_t n );
 static rg_size_t rg_next_index( rg_size_t size, rg_size_t idx );
 static rg_size_t rg_prev_index( rg_size_t size, rg_size_t idx );
 static void rg_rotate( rg_t rg, rg_size_t a, rg_size_t m, rg_size_t b );
@@ -40,14 +83,36 @@ static void rg_rotate( rg_t rg, rg_size_t a, rg_size_t m, rg_size_t b );
 
 rg_t rg_new( rg_size_t size )
 {
-    rg_t rg;
+    rg_ext_t* base;
+    rg_t      rg;
 
-    rg = (rg_t)rg_malloc( rg_struct_size( size ) );
+    base = (rg_ext_t*)rg_malloc( rg_struct_size( size ) );
+    rg = (rg_t)( base + 1 );
 
     rg->ridx = 0;
     rg->widx = 0;
     rg->cnt = 0;
     rg->size = size;
+    rg_ext( rg ) = NULL;
+
+    return rg;
+}
+
+
+rg_t rg_init( void* buf, size_t bytes )
+{
+    rg_t rg;
+
+    if ( bytes < rg_struct_size( RG_MIN_SIZE ) )
+        return NULL;
+
+    rg = (rg_t)( (rg_ext_t*)buf + 1 );
+
+    rg->ridx = 0;
+    rg->widx = 0;
+    rg->cnt = 0;
+    rg->size = ( bytes - rg_struct_size( 0 ) ) / rg_unit_size;
+    rg_ext( rg ) = NULL;
 
     return rg;
 }
@@ -55,17 +120,26 @@ rg_t rg_new( rg_size_t size )
 
 void rg_destroy( rg_p rgr )
 {
-    rg_free( *rgr );
+    if ( rg_ext( *rgr ) ) {
+        rg_free( rg_ext( *rgr )->stamp );
+        rg_free( rg_ext( *rgr ) );
+    }
+    rg_free( rg_base( *rgr ) );
     *rgr = NULL;
 }
 
 
 int rg_put( rg_t rg, void* item )
 {
+    rg_size_t idx;
+
     if ( !rg_is_full( rg ) ) {
-        rg_nth( rg, rg->widx ) = item;
-        rg->widx = rg_next_index( rg->size, rg->widx );
+        idx = rg->widx;
+        rg_nth( rg, idx ) = item;
+        rg->widx = rg_next_index( rg->size, idx );
         rg->cnt++;
+        if ( rg_ext( rg ) )
+            rg_on_put( rg, idx );
         return rg_true;
     } else
         return rg_false;
@@ -74,12 +148,16 @@ int rg_put( rg_t rg, void* item )
 
 void* rg_get( rg_t rg )
 {
-    void* item;
+    void*     item;
+    rg_size_t idx;
 
     if ( !rg_is_empty( rg ) ) {
-        item = rg_nth( rg, rg->ridx );
-        rg->ridx = rg_next_index( rg->size, rg->ridx );
+        idx = rg->ridx;
+        item = rg_nth( rg, idx );
+        rg->ridx = rg_next_index( rg->size, idx );
         rg->cnt--;
+        if ( rg_ext( rg ) )
+            rg_on_get( rg, idx );
         return item;
     } else
         return NULL;
@@ -97,11 +175,15 @@ int rg_ram( rg_p rgr, void* item )
         ret = rg_false;
     }
 
-    rg_t rg;
+    rg_t      rg;
+    rg_size_t idx;
     rg = *rgr;
-    rg_nth( rg, rg->widx ) = item;
-    rg->widx = rg_next_index( rg->size, rg->widx );
+    idx = rg->widx;
+    rg_nth( rg, idx ) = item;
+    rg->widx = rg_next_index( rg->size, idx );
     rg->cnt++;
+    if ( rg_ext( rg ) )
+        rg_on_put( rg, idx );
 
     return ret;
 }
@@ -113,6 +195,8 @@ int rg_put_front( rg_t rg, void* item )
         rg->ridx = rg_prev_index( rg->size, rg->ridx );
         rg_nth( rg, rg->ridx ) = item;
         rg->cnt++;
+        if ( rg_ext( rg ) )
+            rg_on_put( rg, rg->ridx );
         return rg_true;
     } else
         return rg_false;
@@ -127,6 +211,8 @@ void* rg_get_back( rg_t rg )
         rg->widx = rg_prev_index( rg->size, rg->widx );
         item = rg_nth( rg, rg->widx );
         rg->cnt--;
+        if ( rg_ext( rg ) )
+            rg_on_get( rg, rg->widx );
         return item;
     } else
         return NULL;
@@ -173,10 +259,12 @@ void* rg_get_nth( rg_t rg, rg_pos_t pos )
 
         idx = rg->ridx + npos;
         item = rg_nth( rg, idx );
+        if ( rg_ext( rg ) )
+            rg_stamp_get( rg, idx );
 
         if ( idx != rg->ridx ) {
 
-            memmove( &( rg_nth( rg, idx ) ), &( rg_nth( rg, idx + 1 ) ), ( rg->widx - idx ) * rg_unit_size );
+            rg_move( rg, idx, idx + 1, rg->widx - idx );
             rg->widx--;
 
         } else {
@@ -196,15 +284,15 @@ void* rg_get_nth( rg_t rg, rg_pos_t pos )
 
         idx = ( rg->ridx + npos ) % rg->size;
         item = rg_nth( rg, idx );
+        if ( rg_ext( rg ) )
+            rg_stamp_get( rg, idx );
 
         if ( idx < rg->widx ) {
 
             /* -D--w...r---- */
 
             if ( idx != rg->widx-1 ) {
-                memmove( &( rg_nth( rg, idx ) ),
-                         &( rg_nth( rg, idx + 1 ) ),
-                         ( rg->widx - idx - 1 ) * rg_unit_size );
+                rg_move( rg, idx, idx + 1, rg->widx - idx - 1 );
             }
             rg->widx = rg_prev_index( rg->size, rg->widx );
 
@@ -213,14 +301,15 @@ void* rg_get_nth( rg_t rg, rg_pos_t pos )
             /* ----w...r-D-- */
 
             if ( idx != rg->ridx ) {
-                memmove( &( rg_nth( rg, rg->ridx + 1 ) ),
-                         &( rg_nth( rg, rg->ridx ) ),
-                         ( idx - rg->ridx ) * rg_unit_size );
+                rg_move( rg, rg->ridx + 1, rg->ridx, idx - rg->ridx );
             }
             rg->ridx = rg_next_index( rg->size, rg->ridx );
         }
     }
 
+    if ( rg_ext( rg ) )
+        rg_ext_update( rg );
+
     return item;
 }
 
@@ -272,20 +361,250 @@ int rg_resize( rg_p rgr, rg_size_t size )
                 rg_rotate( rg, 0, rg->ridx, rg->size );
         } else {
             /* ....r---w.... */
-            memmove( rg->data, &( rg->data[ rg->ridx ] ), rg->cnt * rg_unit_size );
+            rg_move( rg, 0, rg->ridx, rg->cnt );
         }
         rg->ridx = 0;
         rg->widx = rg->cnt % size;
-            
-        *rgr = (rg_t)rg_realloc( rg, rg_struct_size( size ) );
     }
 
+    *rgr = (rg_t)( (rg_ext_t*)rg_realloc( rg_base( rg ), rg_struct_size( size ) ) + 1 );
     (*rgr)->size = size;
 
+    if ( rg_ext( *rgr ) && rg_ext( *rgr )->stamp )
+        rg_ext( *rgr )->stamp = (rg_size_t*)rg_realloc( rg_ext( *rgr )->stamp, size * sizeof( rg_size_t ) );
+
+    return rg_true;
+}
+
+
+rg_size_t rg_splice( rg_t dst, rg_t src, rg_size_t n )
+{
+    n = rg_splice_count( dst, src, n );
+    if ( n == 0 )
+        return 0;
+
+    rg_copy( dst, dst->widx, src, src->ridx, n );
+
+    dst->widx = ( dst->widx + n ) % dst->size;
+    dst->cnt += n;
+    src->ridx = ( src->ridx + n ) % src->size;
+    src->cnt -= n;
+
+    if ( rg_ext( dst ) )
+        rg_ext_update( dst );
+    if ( rg_ext( src ) )
+        rg_ext_update( src );
+
+    return n;
+}
+
+
+rg_size_t rg_splice_front( rg_t dst, rg_t src, rg_size_t n )
+{
+    rg_size_t didx;
+    rg_size_t sidx;
+
+    n = rg_splice_count( dst, src, n );
+    if ( n == 0 )
+        return 0;
+
+    didx = ( dst->ridx + dst->size - n ) % dst->size;
+    sidx = ( src->widx + src->size - n ) % src->size;
+
+    rg_copy( dst, didx, src, sidx, n );
+
+    dst->ridx = didx;
+    dst->cnt += n;
+    src->widx = sidx;
+    src->cnt -= n;
+
+    if ( rg_ext( dst ) )
+        rg_ext_update( dst );
+    if ( rg_ext( src ) )
+        rg_ext_update( src );
+
+    return n;
+}
+
+
+int rg_concat( rg_p dstr, rg_p srcr )
+{
+    rg_t      dst = *dstr;
+    rg_t      src = *srcr;
+    rg_ext_t  ext;
+    rg_size_t size;
+    int       ret;
+
+    if ( rg_is_empty( dst ) && !rg_stamped( dst ) && !rg_stamped( src ) ) {
+
+        /* Swap Ringers, but keep extensions with references. */
+        *dstr = src;
+        *srcr = dst;
+        ext = rg_ext( src );
+        rg_ext( src ) = rg_ext( dst );
+        rg_ext( dst ) = ext;
+
+        if ( rg_ext( src ) )
+            rg_ext_update( src );
+        if ( rg_ext( dst ) )
+            rg_ext_update( dst );
+
+        return rg_false;
+    }
+
+    ret = rg_false;
+    size = dst->size;
+    while ( size - dst->cnt < src->cnt )
+        size *= 2;
+
+    if ( size != dst->size ) {
+        rg_resize( dstr, size );
+        ret = rg_true;
+    }
+
+    rg_splice( *dstr, src, src->cnt );
+
+    return ret;
+}
+
+
+rg_size_t rg_drain( rg_t rg, rg_drain_fn_t fn, void* ctx, rg_size_t max )
+{
+    rg_size_t n;
+    rg_size_t idx;
+    rg_size_t pidx;
+    rg_size_t ahead;
+    rg_size_t now;
+
+    n = rg->cnt;
+    if ( max > 0 && max < n )
+        n = max;
+    if ( n == 0 )
+        return 0;
+
+    /* Prefetch the first items, then keep distance to callback. */
+    ahead = ( n < RINGER_PREFETCH_DISTANCE ) ? n : RINGER_PREFETCH_DISTANCE;
+    pidx = rg->ridx;
+    for ( rg_size_t i = 0; i < ahead; i++ ) {
+        rg_prefetch( rg_nth( rg, pidx ) );
+        if ( ++pidx == rg->size )
+            pidx = 0;
+    }
+
+    if ( rg_stamped( rg ) ) {
+        now = rg_now();
+        idx = rg->ridx;
+        for ( rg_size_t i = 0; i < n; i++ ) {
+            rg_ext( rg )->dwell( rg, now - rg_ext( rg )->stamp[ idx ], rg_ext( rg )->dwell_ctx );
+            if ( ++idx == rg->size )
+                idx = 0;
+        }
+    }
+
+    idx = rg->ridx;
+    for ( rg_size_t i = 0; i < n; i++ ) {
+
+        if ( ahead < n ) {
+            rg_prefetch( rg_nth( rg, pidx ) );
+            if ( ++pidx == rg->size )
+                pidx = 0;
+            ahead++;
+        }
+
+        fn( rg_nth( rg, idx ), ctx );
+        if ( ++idx == rg->size )
+            idx = 0;
+    }
+
+    rg->ridx = idx;
+    rg->cnt -= n;
+    if ( rg_ext( rg ) )
+        rg_ext_update( rg );
+
+    return n;
+}
+
+
+rg_size_t rg_snapshot( rg_t rg, void** out, rg_size_t max )
+{
+    rg_size_t n;
+    rg_size_t len;
+
+    n = ( rg->cnt < max ) ? rg->cnt : max;
+
+    /* Copy up to the end of storage and then wrap. */
+    len = rg->size - rg->ridx;
+    if ( len > n )
+        len = n;
+    memcpy( out, &rg->data[ rg->ridx ], len * rg_unit_size );
+    memcpy( &out[ len ], &rg->data[ 0 ], ( n - len ) * rg_unit_size );
+
+    return n;
+}
+
+
+int rg_set_marks( rg_t rg, rg_size_t lo, rg_size_t hi, rg_mark_fn_t fn, void* ctx )
+{
+    if ( lo >= hi )
+        return rg_false;
+
+    rg_ext_get( rg );
+
+    rg_ext( rg )->lo = lo;
+    rg_ext( rg )->hi = hi;
+    rg_ext( rg )->fn = fn;
+    rg_ext( rg )->ctx = ctx;
+    rg_ext( rg )->above = ( rg->cnt >= hi );
+
     return rg_true;
 }
 
 
+void rg_clear_marks( rg_t rg )
+{
+    if ( rg_ext( rg ) ) {
+        rg_ext( rg )->fn = NULL;
+        rg_ext_release( rg );
+    }
+}
+
+
+void rg_set_dwell( rg_t rg, rg_dwell_fn_t fn, void* ctx )
+{
+    rg_size_t now;
+    rg_size_t idx;
+
+    rg_ext_get( rg );
+
+    if ( rg_ext( rg )->stamp == NULL ) {
+
+        rg_ext( rg )->stamp = (rg_size_t*)rg_malloc( rg->size * sizeof( rg_size_t ) );
+
+        /* Existing items are timed from now. */
+        now = rg_now();
+        idx = rg->ridx;
+        for ( rg_size_t i = 0; i < rg->cnt; i++ ) {
+            rg_ext( rg )->stamp[ idx ] = now;
+            idx = rg_next_index( rg->size, idx );
+        }
+    }
+
+    rg_ext( rg )->dwell = fn;
+    rg_ext( rg )->dwell_ctx = ctx;
+}
+
+
+void rg_clear_dwell( rg_t rg )
+{
+    if ( rg_ext( rg ) ) {
+        rg_free( rg_ext( rg )->stamp );
+        rg_ext( rg )->stamp = NULL;
+        rg_ext( rg )->dwell = NULL;
+        rg_ext_release( rg );
+    }
+}
+
+
 
 
 /* ------------------------------------------------------------
@@ -293,6 +612,168 @@ int rg_resize( rg_p rgr, rg_size_t size )
  */
 
 
+/**
+ * Copy n items from src (starting at sidx) to dst (starting at didx).
+ *
+ * Items are copied in contiguous runs, i.e. at most three copies
+ * since both source and destination wrap at most once.
+ */
+static void rg_copy( rg_t dst, rg_size_t didx, rg_t src, rg_size_t sidx, rg_size_t n )
+{
+    rg_size_t len;
+
+    while ( n > 0 ) {
+
+        len = n;
+        if ( len > dst->size - didx )
+            len = dst->size - didx;
+        if ( len > src->size - sidx )
+            len = src->size - sidx;
+
+        memcpy( &( rg_nth( dst, didx ) ), &( rg_nth( src, sidx ) ), len * rg_unit_size );
+
+        if ( rg_stamped( dst ) ) {
+            if ( rg_stamped( src ) ) {
+                memcpy( &rg_ext( dst )->stamp[ didx ], &rg_ext( src )->stamp[ sidx ], len * sizeof( rg_size_t ) );
+            } else {
+                for ( rg_size_t i = 0; i < len; i++ )
+                    rg_stamp_put( dst, didx + i );
+            }
+        }
+
+        didx = ( didx + len ) % dst->size;
+        sidx = ( sidx + len ) % src->size;
+        n -= len;
+    }
+}
+
+
+/**
+ * Limit splice count by source items and destination space.
+ */
+static rg_size_t rg_splice_count( rg_t dst, rg_t src, rg_size_t n )
+{
+    if ( n > src->cnt )
+        n = src->cnt;
+    if ( n > dst->size - dst->cnt )
+        n = dst->size - dst->cnt;
+
+    return n;
+}
+
+
+/**
+ * Return extension, create if missing.
+ */
+static rg_ext_t rg_ext_get( rg_t rg )
+{
+    if ( rg_ext( rg ) == NULL ) {
+        rg_ext( rg ) = (rg_ext_t)rg_malloc( sizeof( rg_ext_s ) );
+        memset( rg_ext( rg ), 0, sizeof( rg_ext_s ) );
+    }
+
+    return rg_ext( rg );
+}
+
+
+/**
+ * Release extension if no feature uses it.
+ */
+static void rg_ext_release( rg_t rg )
+{
+    if ( rg_ext( rg )->fn == NULL && rg_ext( rg )->stamp == NULL ) {
+        rg_free( rg_ext( rg ) );
+        rg_ext( rg ) = NULL;
+    }
+}
+
+
+/**
+ * Update extension after item count change.
+ *
+ * Watermark callback is called when a watermark is crossed.
+ */
+static void rg_ext_update( rg_t rg )
+{
+    rg_ext_t ext = rg_ext( rg );
+
+    if ( ext->fn ) {
+        if ( !ext->above && rg->cnt >= ext->hi ) {
+            ext->above = rg_true;
+            ext->fn( rg, rg_true, ext->ctx );
+        } else if ( ext->above && rg->cnt <= ext->lo ) {
+            ext->above = rg_false;
+            ext->fn( rg, rg_false, ext->ctx );
+        }
+    }
+}
+
+
+/**
+ * Update extension after item at idx has been put.
+ */
+static void rg_on_put( rg_t rg, rg_size_t idx )
+{
+    rg_stamp_put( rg, idx );
+    rg_ext_update( rg );
+}
+
+
+/**
+ * Update extension after item at idx has been taken.
+ */
+static void rg_on_get( rg_t rg, rg_size_t idx )
+{
+    rg_stamp_get( rg, idx );
+    rg_ext_update( rg );
+}
+
+
+/**
+ * Return monotonic time in nanoseconds.
+ */
+static rg_size_t rg_now( void )
+{
+    struct timespec ts;
+
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+
+    return (rg_size_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+
+/**
+ * Stamp put time for item at idx.
+ */
+static void rg_stamp_put( rg_t rg, rg_size_t idx )
+{
+    if ( rg_ext( rg )->stamp )
+        rg_ext( rg )->stamp[ idx ] = rg_now();
+}
+
+
+/**
+ * Report dwell time of item at idx.
+ */
+static void rg_stamp_get( rg_t rg, rg_size_t idx )
+{
+    if ( rg_ext( rg )->stamp && rg_ext( rg )->dwell )
+        rg_ext( rg )->dwell( rg, rg_now() - rg_ext( rg )->stamp[ idx ], rg_ext( rg )->dwell_ctx );
+}
+
+
+/**
+ * Move n items (and stamps) within storage.
+ */
+static void rg_move( rg_t rg, rg_size_t dst, rg_size_t src, rg_size_t n )
+{
+    memmove( &( rg_nth( rg, dst ) ), &( rg_nth( rg, src ) ), n * rg_unit_size );
+
+    if ( rg_stamped( rg ) )
+        memmove( &rg_ext( rg )->stamp[ dst ], &rg_ext( rg )->stamp[ src ], n * sizeof( rg_size_t ) );
+}
+
+
 static rg_size_t rg_next_index( rg_size_t size, rg_size_t idx )
 {
     return ( ( rg_size_t )( idx + 1 ) ) % size;
@@ -309,12 +790,21 @@ static void rg_rotate( rg_t rg, rg_size_t a, rg_size_t m, rg_size_t b )
 {
     rg_size_t n = m;
     void* swap;
+    rg_size_t* stamp;
+    rg_size_t tmp;
+
+    stamp = rg_stamped( rg ) ? rg_ext( rg )->stamp : NULL;
 
     while ( a != n ) {
 
         swap = rg_nth( rg, a );
         rg_nth( rg, a ) = rg_nth( rg, n );
         rg_nth( rg, n ) = swap;
+        if ( stamp ) {
+            tmp = stamp[ a ];
+            stamp[ a ] = stamp[ n ];
+            stamp[ n ] = tmp;
+        }
         a++;
         n++;
 
@@ -48,6 +48,45 @@ typedef rg_s*              rg_t; /**< Ringer pointer. */
 typedef rg_t*              rg_p; /**< Ringer pointer reference. */
 
 
+/** Bytes needed for Ringer of size, with extension slot (for rg_init). */
+#define RG_BYTES( size ) ( sizeof( void* ) + sizeof( rg_s ) + ( size ) * sizeof( void* ) )
+
+
+/**
+ * Watermark callback.
+ *
+ * @param rg   Ringer.
+ * @param high 1 for high watermark (0 for low).
+ * @param ctx  Callback context.
+ */
+typedef void ( *rg_mark_fn_t )( rg_t rg, int high, void* ctx );
+
+
+/**
+ * Dwell time callback.
+ *
+ * @param rg  Ringer.
+ * @param ns  Time item spent in Ringer (nanoseconds).
+ * @param ctx Callback context.
+ */
+typedef void ( *rg_dwell_fn_t )( rg_t rg, rg_size_t ns, void* ctx );
+
+
+/**
+ * Drain callback.
+ *
+ * @param item Item.
+ * @param ctx  Callback context.
+ */
+typedef void ( *rg_drain_fn_t )( void* item, void* ctx );
+
+
+#ifndef RINGER_PREFETCH_DISTANCE
+/** Number of items prefetched ahead in rg_drain(). */
+#define RINGER_PREFETCH_DISTANCE 8
+#endif
+
+
 #ifdef RINGER_USE_MEM_API
 
 /*
@@ -93,6 +132,27 @@ extern void* rg_realloc( void* ptr, size_t size );
 rg_t rg_new( rg_size_t size );
 
 
+/**
+ * Initialize Ringer to user storage.
+ *
+ * Ringer is placed after the extension slot at the start of the
+ * buffer, and the rest of the buffer is used for items. Buffer must
+ * be aligned for pointers, and it must stay valid while Ringer is
+ * used. Use RG_BYTES() to get the buffer size for a Ringer size.
+ *
+ * Ringer with user storage is not released with rg_destroy(), and it
+ * must not be resized, i.e. rg_ram(), rg_resize(), and rg_concat()
+ * are not allowed. Watermarks must be cleared before the buffer is
+ * released.
+ *
+ * @param buf   Buffer.
+ * @param bytes Buffer size in bytes.
+ *
+ * @return Ringer (or NULL if buffer is too small).
+ */
+rg_t rg_init( void* buf, size_t bytes );
+
+
 /**
  * Destroy Ringer.
  *
@@ -254,4 +314,135 @@ rg_size_t rg_size( rg_t rg );
 int rg_resize( rg_p rgr, rg_size_t size );
 
 
+/**
+ * Move items from front of source to back of destination.
+ *
+ * Items are moved in order, as many as fit to destination. Source
+ * and destination must be different.
+ *
+ * @param dst Destination Ringer.
+ * @param src Source Ringer.
+ * @param n   Maximum item count.
+ *
+ * @return Number of items moved.
+ */
+rg_size_t rg_splice( rg_t dst, rg_t src, rg_size_t n );
+
+
+/**
+ * Move items from back of source to front of destination.
+ *
+ * Items are moved in order, i.e. the last source item becomes the
+ * item before the first destination item. Items are moved as many as
+ * fit to destination. Source and destination must be different.
+ *
+ * @param dst Destination Ringer.
+ * @param src Source Ringer.
+ * @param n   Maximum item count.
+ *
+ * @return Number of items moved.
+ */
+rg_size_t rg_splice_front( rg_t dst, rg_t src, rg_size_t n );
+
+
+/**
+ * Move all items from source to back of destination.
+ *
+ * Destination is resized, by doubling, if items don't fit. If
+ * destination is empty, Ringers are swapped instead of copying items
+ * (including storage sizes), unless dwell times are used. Watermarks
+ * stay with the references.
+ *
+ * @param dstr Destination Ringer reference.
+ * @param srcr Source Ringer reference.
+ *
+ * @return 1 if destination was resized (else 0).
+ */
+int rg_concat( rg_p dstr, rg_p srcr );
+
+
+/**
+ * Get items from Ringer to callback.
+ *
+ * Items are passed to callback in queue order. Items (pointees) are
+ * prefetched RINGER_PREFETCH_DISTANCE items ahead of callback. Ringer
+ * state is updated once after all items are passed, hence callback
+ * must not use the Ringer.
+ *
+ * @param rg  Ringer.
+ * @param fn  Callback.
+ * @param ctx Callback context.
+ * @param max Maximum item count (0 for all).
+ *
+ * @return Number of items drained.
+ */
+rg_size_t rg_drain( rg_t rg, rg_drain_fn_t fn, void* ctx, rg_size_t max );
+
+
+/**
+ * Copy items of Ringer to array.
+ *
+ * Items are copied in queue order, starting from Read Index. No
+ * changes to Ringer state. For a Ringer shared between threads, see
+ * rgs_snapshot().
+ *
+ * @param rg  Ringer.
+ * @param out Item array.
+ * @param max Maximum item count.
+ *
+ * @return Number of items copied.
+ */
+rg_size_t rg_snapshot( rg_t rg, void** out, rg_size_t max );
+
+
+/**
+ * Set watermarks for Ringer.
+ *
+ * Callback is called with high set, when item count rises to hi. It
+ * is called with high cleared, when item count falls to lo after
+ * that. Hence callback is called once per crossing.
+ *
+ * @param rg  Ringer.
+ * @param lo  Low watermark.
+ * @param hi  High watermark.
+ * @param fn  Callback.
+ * @param ctx Callback context.
+ *
+ * @return 1 on success (0 if lo is not below hi).
+ */
+int rg_set_marks( rg_t rg, rg_size_t lo, rg_size_t hi, rg_mark_fn_t fn, void* ctx );
+
+
+/**
+ * Remove watermarks from Ringer.
+ *
+ * @param rg Ringer.
+ */
+void rg_clear_marks( rg_t rg );
+
+
+/**
+ * Set dwell time callback for Ringer.
+ *
+ * Put time of each item is stored (monotonic clock) to an array
+ * parallel to items, and callback is called with the time the item
+ * spent in Ringer when the item is got (rg_get(), rg_get_back(),
+ * rg_get_nth(), and rg_drain()). Items in Ringer are timed from the
+ * call. See rgh_dwell() for recording to histogram.
+ *
+ * @param rg  Ringer.
+ * @param fn  Callback.
+ * @param ctx Callback context.
+ */
+void rg_set_dwell( rg_t rg, rg_dwell_fn_t fn, void* ctx );
+
+
+/**
+ * Remove dwell time callback (and timestamps) from Ringer.
+ *
+ * @param rg Ringer.
+ */
+void rg_clear_dwell( rg_t rg );
+
+
 #endif
@@ -0,0 +1,253 @@
+/**
+ * @file   ringer_bip.c
+ * @author agent <agent@local>
+ * @date   Sun Oct 18 14:38:26 2026
+ *
+ * @brief  Byte Ringer (bip-buffer).
+ *
+ */
+
+#include <errno.h>
+#include <sys/uio.h>
+#include "ringer_bip.h"
+
+
+/* clang-format off */
+
+/** @cond ringer_none */
+#define rgb_a_len( rb )   ( rb->a_end - rb->a_start )
+/** @endcond ringer_none */
+
+/* clang-format on */
+
+
+static void rgb_fill( rgb_t rb, rg_size_t n );
+
+
+
+/* ------------------------------------------------------------
+ * Byte Ringer:
+ */
+
+
+rgb_t rgb_new( rg_size_t size )
+{
+    rgb_t rb;
+
+    rb = (rgb_t)rg_malloc( sizeof( rgb_s ) + size );
+
+    rb->a_start = 0;
+    rb->a_end = 0;
+    rb->b_end = 0;
+    rb->res_start = 0;
+    rb->res_len = 0;
+    rb->size = size;
+
+    return rb;
+}
+
+
+void rgb_destroy( rgb_p rbr )
+{
+    rg_free( *rbr );
+    *rbr = NULL;
+}
+
+
+void* rgb_reserve( rgb_t rb, rg_size_t n )
+{
+    if ( n == 0 )
+        return NULL;
+
+    if ( rb->b_end > 0 ) {
+
+        /* Region B grows towards region A. */
+        if ( rb->a_start - rb->b_end < n )
+            return NULL;
+        rb->res_start = rb->b_end;
+
+    } else if ( rb->size - rb->a_end >= n ) {
+
+        /* Space after region A. */
+        rb->res_start = rb->a_end;
+
+    } else if ( rb->a_start >= n ) {
+
+        /* Space before region A, starts region B. */
+        rb->res_start = 0;
+
+    } else {
+
+        return NULL;
+    }
+
+    rb->res_len = n;
+
+    return &rb->data[ rb->res_start ];
+}
+
+
+void rgb_commit( rgb_t rb, rg_size_t n )
+{
+    if ( n > rb->res_len )
+        n = rb->res_len;
+
+    if ( n > 0 ) {
+        if ( rb->res_start == rb->a_end && rb->b_end == 0 )
+            rb->a_end += n;
+        else
+            rb->b_end = rb->res_start + n;
+    }
+
+    rb->res_len = 0;
+}
+
+
+void* rgb_peek( rgb_t rb, rg_size_t* len )
+{
+    *len = rgb_a_len( rb );
+
+    if ( *len > 0 )
+        return &rb->data[ rb->a_start ];
+    else
+        return NULL;
+}
+
+
+void rgb_consume( rgb_t rb, rg_size_t n )
+{
+    if ( n > rgb_a_len( rb ) )
+        n = rgb_a_len( rb );
+
+    rb->a_start += n;
+
+    /*
+     * Region B becomes region A, or restart from beginning. Region A
+     * stays in place if a pending reservation follows it.
+     */
+    if ( rb->a_start == rb->a_end
+         && !( rb->res_len > 0 && rb->b_end == 0 && rb->res_start == rb->a_end ) ) {
+        rb->a_start = 0;
+        rb->a_end = rb->b_end;
+        rb->b_end = 0;
+    }
+}
+
+
+ssize_t rgb_readv( rgb_t rb, int fd )
+{
+    struct iovec iov[ 2 ];
+    int          cnt;
+    ssize_t      ret;
+
+    cnt = 0;
+
+    if ( rb->b_end > 0 ) {
+        iov[ cnt ].iov_base = &rb->data[ rb->b_end ];
+        iov[ cnt++ ].iov_len = rb->a_start - rb->b_end;
+    } else {
+        if ( rb->a_end < rb->size ) {
+            iov[ cnt ].iov_base = &rb->data[ rb->a_end ];
+            iov[ cnt++ ].iov_len = rb->size - rb->a_end;
+        }
+        if ( rb->a_start > 0 ) {
+            iov[ cnt ].iov_base = rb->data;
+            iov[ cnt++ ].iov_len = rb->a_start;
+        }
+    }
+
+    if ( cnt == 0 || iov[ 0 ].iov_len == 0 ) {
+        errno = ENOBUFS;
+        return -1;
+    }
+
+    ret = readv( fd, iov, cnt );
+
+    if ( ret > 0 )
+        rgb_fill( rb, ret );
+
+    return ret;
+}
+
+
+ssize_t rgb_writev( rgb_t rb, int fd )
+{
+    struct iovec iov[ 2 ];
+    int          cnt;
+    ssize_t      ret;
+    rg_size_t    len;
+    rg_size_t    part;
+
+    cnt = 0;
+
+    if ( rgb_a_len( rb ) > 0 ) {
+        iov[ cnt ].iov_base = &rb->data[ rb->a_start ];
+        iov[ cnt++ ].iov_len = rgb_a_len( rb );
+    }
+    if ( rb->b_end > 0 ) {
+        iov[ cnt ].iov_base = rb->data;
+        iov[ cnt++ ].iov_len = rb->b_end;
+    }
+
+    if ( cnt == 0 )
+        return 0;
+
+    ret = writev( fd, iov, cnt );
+
+    /* Written data may continue from region A to region B. */
+    len = ret > 0 ? ret : 0;
+    while ( len > 0 ) {
+        part = len < rgb_a_len( rb ) ? len : rgb_a_len( rb );
+        rgb_consume( rb, part );
+        len -= part;
+    }
+
+    return ret;
+}
+
+
+rg_size_t rgb_count( rgb_t rb )
+{
+    return rgb_a_len( rb ) + rb->b_end;
+}
+
+
+int rgb_is_empty( rgb_t rb )
+{
+    return rgb_a_len( rb ) == 0;
+}
+
+
+rg_size_t rgb_size( rgb_t rb )
+{
+    return rb->size;
+}
+
+
+
+
+/* ------------------------------------------------------------
+ * Internal functions:
+ */
+
+
+/**
+ * Add n bytes read to free space after data.
+ *
+ * Free space after region A is filled first, and the rest goes to
+ * region B.
+ */
+static void rgb_fill( rgb_t rb, rg_size_t n )
+{
+    rg_size_t len;
+
+    if ( rb->b_end == 0 ) {
+        len = rb->size - rb->a_end;
+        if ( len > n )
+            len = n;
+        rb->a_end += len;
+        n -= len;
+    }
+
+    rb->b_end += n;
+}
@@ -0,0 +1,178 @@
+#ifndef RINGER_BIP_H
+#define RINGER_BIP_H
+
+/**
+ * @file   ringer_bip.h
+ * @author agent <agent@local>
+ * @date   Sun Oct 18 14:38:26 2026
+ *
+ * @brief  Byte Ringer (bip-buffer).
+ *
+ * Byte Ringer stores bytes, instead of pointers. Storage has two
+ * regions: region A is the data to read next, and region B starts at
+ * the beginning of storage when writing wraps over. Data is always
+ * read from region A, and when region A is consumed, region B becomes
+ * region A. Hence reserved space and read data are always contiguous,
+ * and records can be used in place.
+ *
+ * Byte Ringer has helpers for filling from file descriptor with
+ * readv(), and for draining to file descriptor with writev(), without
+ * intermediate copies.
+ *
+ */
+
+#include <sys/types.h>
+#include "ringer.h"
+
+
+/**
+ * Byte Ringer struct.
+ */
+struct rgb_struct_s
+{
+    rg_size_t a_start;   /**< Region A start. */
+    rg_size_t a_end;     /**< Region A end. */
+    rg_size_t b_end;     /**< Region B end (0 if not used). */
+    rg_size_t res_start; /**< Reservation start. */
+    rg_size_t res_len;   /**< Reservation length. */
+    rg_size_t size;      /**< Storage size in bytes. */
+    char      data[ 0 ]; /**< Byte array. */
+};
+typedef struct rgb_struct_s rgb_s; /**< Byte Ringer struct. */
+typedef rgb_s*              rgb_t; /**< Byte Ringer pointer. */
+typedef rgb_t*              rgb_p; /**< Byte Ringer pointer reference. */
+
+
+
+/* ------------------------------------------------------------
+ * Byte Ringer:
+ */
+
+
+/**
+ * Create Byte Ringer with size.
+ *
+ * @param size Size in bytes.
+ *
+ * @return Byte Ringer.
+ */
+rgb_t rgb_new( rg_size_t size );
+
+
+/**
+ * Destroy Byte Ringer.
+ *
+ * @param rbr Byte Ringer reference.
+ */
+void rgb_destroy( rgb_p rbr );
+
+
+/**
+ * Reserve contiguous space from Byte Ringer.
+ *
+ * Reserved space is written by the user and committed with
+ * rgb_commit(). Only one reservation can be pending.
+ *
+ * @param rb Byte Ringer.
+ * @param n  Byte count.
+ *
+ * @return Reserved space (or NULL if not available).
+ */
+void* rgb_reserve( rgb_t rb, rg_size_t n );
+
+
+/**
+ * Commit reserved space.
+ *
+ * Committed data is available for reading. Commit can be shorter than
+ * reservation, and the rest of the reservation is released.
+ *
+ * @param rb Byte Ringer.
+ * @param n  Byte count (at most reserved).
+ */
+void rgb_commit( rgb_t rb, rg_size_t n );
+
+
+/**
+ * Peek contiguous data from Byte Ringer.
+ *
+ * Data is the first region, i.e. all data is not necessarily
+ * returned.
+ *
+ * @param rb  Byte Ringer.
+ * @param len Data length.
+ *
+ * @return Data (or NULL if empty).
+ */
+void* rgb_peek( rgb_t rb, rg_size_t* len );
+
+
+/**
+ * Consume data peeked from Byte Ringer.
+ *
+ * @param rb Byte Ringer.
+ * @param n  Byte count (at most peeked length).
+ */
+void rgb_consume( rgb_t rb, rg_size_t n );
+
+
+/**
+ * Read from file descriptor to Byte Ringer.
+ *
+ * All free space is filled with one readv(). Reservation must not be
+ * pending.
+ *
+ * @param rb Byte Ringer.
+ * @param fd File descriptor.
+ *
+ * @return Bytes read, 0 for end of file, or -1 for error (errno is
+ *         ENOBUFS if Byte Ringer is full).
+ */
+ssize_t rgb_readv( rgb_t rb, int fd );
+
+
+/**
+ * Write from Byte Ringer to file descriptor.
+ *
+ * All data is written with one writev(), and the written data is
+ * consumed.
+ *
+ * @param rb Byte Ringer.
+ * @param fd File descriptor.
+ *
+ * @return Bytes written, or -1 for error.
+ */
+ssize_t rgb_writev( rgb_t rb, int fd );
+
+
+/**
+ * Return data byte count of Byte Ringer.
+ *
+ * @param rb Byte Ringer.
+ *
+ * @return Count.
+ */
+rg_size_t rgb_count( rgb_t rb );
+
+
+/**
+ * Is Byte Ringer empty?
+ *
+ * @param rb Byte Ringer.
+ *
+ * @return 1 if empty.
+ */
+int rgb_is_empty( rgb_t rb );
+
+
+/**
+ * Return Byte Ringer storage size.
+ *
+ * @param rb Byte Ringer.
+ *
+ * @return Size in bytes.
+ */
+rg_size_t rgb_size( rgb_t rb );
+
+
+#endif
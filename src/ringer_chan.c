@@ -0,0 +1,204 @@
+/**
+ * @file   ringer_chan.c
+ * @author agent <agent@local>
+ * @date   Sun Oct 18 14:33:58 2026
+ *
+ * @brief  Channel for coroutines on top of Ringer.
+ *
+ */
+
+#include "ringer_chan.h"
+
+
+static void rgch_enqueue( rgch_wait_t* head, rgch_wait_t* tail, rgch_wait_t w );
+static rgch_wait_t rgch_dequeue( rgch_wait_t* head, rgch_wait_t* tail );
+static void rgch_complete( rgch_t ch, rgch_wait_t w, int status );
+
+
+
+/* ------------------------------------------------------------
+ * Channel:
+ */
+
+
+rgch_t rgch_new( rg_size_t size )
+{
+    rgch_t ch;
+
+    ch = (rgch_t)rg_malloc( sizeof( rgch_s ) );
+
+    ch->rg = rg_new( size );
+    ch->push_head = NULL;
+    ch->push_tail = NULL;
+    ch->pop_head = NULL;
+    ch->pop_tail = NULL;
+    ch->exec = NULL;
+    ch->exec_ctx = NULL;
+    ch->closed = 0;
+
+    return ch;
+}
+
+
+void rgch_destroy( rgch_p chr )
+{
+    rg_destroy( &( *chr )->rg );
+    rg_free( *chr );
+    *chr = NULL;
+}
+
+
+void rgch_set_executor( rgch_t ch, rgch_exec_fn_t exec, void* ctx )
+{
+    ch->exec = exec;
+    ch->exec_ctx = ctx;
+}
+
+
+int rgch_push( rgch_t ch, void* item, rgch_wait_t w )
+{
+    rgch_wait_t popper;
+
+    if ( ch->closed )
+        return RGCH_CLOSED;
+
+    if ( ch->pop_head ) {
+
+        /* Channel is empty, hand item directly to popper. */
+        popper = rgch_dequeue( &ch->pop_head, &ch->pop_tail );
+        popper->item = item;
+        rgch_complete( ch, popper, RGCH_DONE );
+        return RGCH_DONE;
+
+    } else if ( rg_put( ch->rg, item ) ) {
+
+        return RGCH_DONE;
+
+    } else if ( w ) {
+
+        w->item = item;
+        w->status = RGCH_WAIT;
+        rgch_enqueue( &ch->push_head, &ch->push_tail, w );
+        return RGCH_WAIT;
+
+    } else {
+
+        return RGCH_WAIT;
+    }
+}
+
+
+int rgch_pop( rgch_t ch, void** item, rgch_wait_t w )
+{
+    rgch_wait_t pusher;
+
+    if ( !rg_is_empty( ch->rg ) ) {
+
+        *item = rg_get( ch->rg );
+
+        /* Space available, store item of first pusher. */
+        if ( ch->push_head ) {
+            pusher = rgch_dequeue( &ch->push_head, &ch->push_tail );
+            rg_put( ch->rg, pusher->item );
+            rgch_complete( ch, pusher, RGCH_DONE );
+        }
+
+        return RGCH_DONE;
+
+    } else if ( ch->push_head ) {
+
+        /* No storage (size 0), take item directly from pusher. */
+        pusher = rgch_dequeue( &ch->push_head, &ch->push_tail );
+        *item = pusher->item;
+        rgch_complete( ch, pusher, RGCH_DONE );
+        return RGCH_DONE;
+
+    } else if ( ch->closed ) {
+
+        return RGCH_CLOSED;
+
+    } else if ( w ) {
+
+        w->item = NULL;
+        w->status = RGCH_WAIT;
+        rgch_enqueue( &ch->pop_head, &ch->pop_tail, w );
+        return RGCH_WAIT;
+
+    } else {
+
+        return RGCH_WAIT;
+    }
+}
+
+
+void rgch_close( rgch_t ch )
+{
+    rgch_wait_t w;
+
+    ch->closed = 1;
+
+    while ( ( w = rgch_dequeue( &ch->push_head, &ch->push_tail ) ) )
+        rgch_complete( ch, w, RGCH_CLOSED );
+
+    while ( ( w = rgch_dequeue( &ch->pop_head, &ch->pop_tail ) ) )
+        rgch_complete( ch, w, RGCH_CLOSED );
+}
+
+
+void rgch_resume( rgch_wait_t w )
+{
+    w->resume( w );
+}
+
+
+rg_size_t rgch_count( rgch_t ch )
+{
+    return rg_count( ch->rg );
+}
+
+
+
+
+/* ------------------------------------------------------------
+ * Internal functions:
+ */
+
+
+static void rgch_enqueue( rgch_wait_t* head, rgch_wait_t* tail, rgch_wait_t w )
+{
+    w->next = NULL;
+    if ( *tail )
+        ( *tail )->next = w;
+    else
+        *head = w;
+    *tail = w;
+}
+
+
+static rgch_wait_t rgch_dequeue( rgch_wait_t* head, rgch_wait_t* tail )
+{
+    rgch_wait_t w = *head;
+
+    if ( w ) {
+        *head = w->next;
+        if ( *head == NULL )
+            *tail = NULL;
+        w->next = NULL;
+    }
+
+    return w;
+}
+
+
+/**
+ * Complete waiter and resume it directly or through executor.
+ */
+static void rgch_complete( rgch_t ch, rgch_wait_t w, int status )
+{
+    w->status = status;
+
+    if ( ch->exec )
+        ch->exec( w, ch->exec_ctx );
+    else
+        w->resume( w );
+}
@@ -0,0 +1,199 @@
+#ifndef RINGER_CHAN_H
+#define RINGER_CHAN_H
+
+/**
+ * @file   ringer_chan.h
+ * @author agent <agent@local>
+ * @date   Sun Oct 18 14:33:58 2026
+ *
+ * @brief  Channel for coroutines on top of Ringer.
+ *
+ * Channel stores items to Ringer. When Channel is full (or empty),
+ * the pushing (or popping) task is queued as a waiter, and the waiter
+ * is resumed when the operation completes. Waiting popper receives
+ * the item directly from pusher, and waiting pusher gets its item
+ * stored by popper.
+ *
+ * Channel is not thread safe, i.e. it is used by tasks of one thread
+ * (executor). See ringer_chan.hpp for C++20 coroutine interface.
+ *
+ */
+
+#include "ringer.h"
+
+
+/** Operation completed. */
+#define RGCH_DONE 1
+
+/** Operation is waiting. */
+#define RGCH_WAIT 0
+
+/** Channel is closed. */
+#define RGCH_CLOSED -1
+
+
+typedef struct rgch_wait_s rgch_wait_s; /**< Waiter struct. */
+typedef rgch_wait_s*       rgch_wait_t; /**< Waiter pointer. */
+
+
+/**
+ * Waiter resume function.
+ *
+ * @param w Waiter.
+ */
+typedef void ( *rgch_resume_fn_t )( rgch_wait_t w );
+
+
+/**
+ * Executor function.
+ *
+ * Executor takes the completed waiter and resumes it later with
+ * rgch_resume().
+ *
+ * @param w   Waiter.
+ * @param ctx Executor context.
+ */
+typedef void ( *rgch_exec_fn_t )( rgch_wait_t w, void* ctx );
+
+
+/**
+ * Waiter struct.
+ *
+ * Waiter is owned by the waiting task, e.g. it is part of coroutine
+ * frame.
+ */
+struct rgch_wait_s
+{
+    rgch_wait_t      next;   /**< Next waiter. */
+    void*            item;   /**< Pushed item or popped item. */
+    int              status; /**< Operation status. */
+    rgch_resume_fn_t resume; /**< Resume function. */
+    void*            ctx;    /**< Resume context. */
+};
+
+
+/**
+ * Channel struct.
+ */
+struct rgch_struct_s
+{
+    rg_t           rg;        /**< Item storage. */
+    rgch_wait_t    push_head; /**< First waiting pusher. */
+    rgch_wait_t    push_tail; /**< Last waiting pusher. */
+    rgch_wait_t    pop_head;  /**< First waiting popper. */
+    rgch_wait_t    pop_tail;  /**< Last waiting popper. */
+    rgch_exec_fn_t exec;      /**< Executor (NULL for direct resume). */
+    void*          exec_ctx;  /**< Executor context. */
+    int            closed;    /**< Channel closed. */
+};
+typedef struct rgch_struct_s rgch_s; /**< Channel struct. */
+typedef rgch_s*              rgch_t; /**< Channel pointer. */
+typedef rgch_t*              rgch_p; /**< Channel pointer reference. */
+
+
+
+/* ------------------------------------------------------------
+ * Channel:
+ */
+
+
+/**
+ * Create Channel with size.
+ *
+ * Channel with size 0 has no storage, and each push waits for a
+ * popper (or popper for a pusher), i.e. items are handed over
+ * directly.
+ *
+ * @param size Size (or 0 for direct handover).
+ *
+ * @return Channel.
+ */
+rgch_t rgch_new( rg_size_t size );
+
+
+/**
+ * Destroy Channel.
+ *
+ * Channel must not have waiters.
+ *
+ * @param chr Channel reference.
+ */
+void rgch_destroy( rgch_p chr );
+
+
+/**
+ * Set executor for Channel.
+ *
+ * By default waiters are resumed directly from the operation that
+ * completes them. With executor, completed waiters are handed to the
+ * executor, which may resume them in batches.
+ *
+ * @param ch   Channel.
+ * @param exec Executor (or NULL).
+ * @param ctx  Executor context.
+ */
+void rgch_set_executor( rgch_t ch, rgch_exec_fn_t exec, void* ctx );
+
+
+/**
+ * Push item to Channel.
+ *
+ * If Channel is full and waiter is given, waiter is queued and it is
+ * resumed when the item has been stored. If waiter is NULL, nothing
+ * is done for full Channel.
+ *
+ * @param ch   Channel.
+ * @param item Item.
+ * @param w    Waiter (or NULL).
+ *
+ * @return RGCH_DONE, RGCH_WAIT, or RGCH_CLOSED.
+ */
+int rgch_push( rgch_t ch, void* item, rgch_wait_t w );
+
+
+/**
+ * Pop item from Channel.
+ *
+ * If Channel is empty and waiter is given, waiter is queued and it
+ * is resumed with the item in waiter. If waiter is NULL, nothing is
+ * done for empty Channel.
+ *
+ * @param ch   Channel.
+ * @param item Popped item (for RGCH_DONE).
+ * @param w    Waiter (or NULL).
+ *
+ * @return RGCH_DONE, RGCH_WAIT, or RGCH_CLOSED.
+ */
+int rgch_pop( rgch_t ch, void** item, rgch_wait_t w );
+
+
+/**
+ * Close Channel.
+ *
+ * Waiting pushers and poppers are resumed with RGCH_CLOSED
+ * status. Items in Channel can still be popped.
+ *
+ * @param ch Channel.
+ */
+void rgch_close( rgch_t ch );
+
+
+/**
+ * Resume waiter.
+ *
+ * @param w Waiter.
+ */
+void rgch_resume( rgch_wait_t w );
+
+
+/**
+ * Return item count of Channel.
+ *
+ * @param ch Channel.
+ *
+ * @return Count.
+ */
+rg_size_t rgch_count( rgch_t ch );
+
+
+#endif
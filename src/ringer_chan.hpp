@@ -0,0 +1,200 @@
+#ifndef RINGER_CHAN_HPP
+#define RINGER_CHAN_HPP
+
+/**
+ * @file   ringer_chan.hpp
+ * @author agent <agent@local>
+ * @date   Sun Oct 18 14:33:58 2026
+ *
+ * @brief  C++20 coroutine interface for Channel.
+ *
+ * Channel items are pointers:
+ *
+ *     ringer::channel<msg_t> ch( 64 );
+ *
+ *     co_await ch.push( msg );
+ *     msg_t* msg = co_await ch.pop();
+ *
+ * push() returns false and pop() returns nullptr when Channel is
+ * closed. Operations that don't wait complete without suspending.
+ *
+ * Completed waiters are resumed through a per thread ready queue. The
+ * first resume runs the queue, and resumes within it are queued, so
+ * the stack does not grow with the number of handoffs. Suspending
+ * awaiter returns to the queue loop, which resumes the next ready
+ * coroutine, so stack depth is bounded without relying on tail calls.
+ *
+ */
+
+#include <coroutine>
+
+extern "C" {
+#include "ringer_chan.h"
+}
+
+
+namespace ringer
+{
+
+namespace detail
+{
+
+/**
+ * Ready queue of completed waiters.
+ */
+struct ready_queue
+{
+    rgch_wait_t head = nullptr; /**< First ready waiter. */
+    rgch_wait_t tail = nullptr; /**< Last ready waiter. */
+    bool        active = false; /**< Queue is being run. */
+};
+
+/** Ready queue of thread. */
+inline thread_local ready_queue ready;
+
+
+/** Take next ready coroutine (or noop coroutine if none). */
+inline std::coroutine_handle<> next_ready()
+{
+    rgch_wait_t w = ready.head;
+
+    if ( w == nullptr )
+        return std::noop_coroutine();
+
+    ready.head = w->next;
+    if ( ready.head == nullptr )
+        ready.tail = nullptr;
+    w->next = nullptr;
+
+    return std::coroutine_handle<>::from_address( w->ctx );
+}
+
+}
+
+
+/**
+ * Channel for coroutines.
+ */
+template <typename T>
+class channel
+{
+  public:
+    /** Create Channel with size. */
+    explicit channel( rg_size_t size ) : m_ch( rgch_new( size ) ) {}
+
+    ~channel() { rgch_destroy( &m_ch ); }
+
+    channel( const channel& ) = delete;
+    channel& operator=( const channel& ) = delete;
+
+
+    /** Awaiter base, resumes coroutine of waiter. */
+    struct waiter : rgch_wait_s
+    {
+        waiter()
+        {
+            next = nullptr;
+            item = nullptr;
+            status = RGCH_WAIT;
+            resume = &waiter::resume_coro;
+            ctx = nullptr;
+        }
+
+        /** Queue waiter, and run queue unless already running. */
+        static void resume_coro( rgch_wait_t w )
+        {
+            detail::ready_queue& rq = detail::ready;
+
+            if ( rq.active ) {
+                w->next = nullptr;
+                if ( rq.tail )
+                    rq.tail->next = w;
+                else
+                    rq.head = w;
+                rq.tail = w;
+                return;
+            }
+
+            rq.active = true;
+            std::coroutine_handle<>::from_address( w->ctx ).resume();
+            while ( rq.head )
+                detail::next_ready().resume();
+            rq.active = false;
+        }
+    };
+
+
+    /** Push awaiter. */
+    struct push_op : waiter
+    {
+        push_op( rgch_t ch, T* item ) : m_ch( ch ), m_item( item ) {}
+
+        bool await_ready()
+        {
+            this->status = rgch_push( m_ch, m_item, nullptr );
+            return this->status != RGCH_WAIT;
+        }
+
+        bool await_suspend( std::coroutine_handle<> h )
+        {
+            this->ctx = h.address();
+            this->status = rgch_push( m_ch, m_item, this );
+            return this->status == RGCH_WAIT;
+        }
+
+        bool await_resume() { return this->status == RGCH_DONE; }
+
+        rgch_t m_ch;
+        T*     m_item;
+    };
+
+
+    /** Pop awaiter. */
+    struct pop_op : waiter
+    {
+        explicit pop_op( rgch_t ch ) : m_ch( ch ) {}
+
+        bool await_ready()
+        {
+            this->status = rgch_pop( m_ch, &this->item, nullptr );
+            return this->status != RGCH_WAIT;
+        }
+
+        bool await_suspend( std::coroutine_handle<> h )
+        {
+            this->ctx = h.address();
+            this->status = rgch_pop( m_ch, &this->item, this );
+            return this->status == RGCH_WAIT;
+        }
+
+        T* await_resume() { return this->status == RGCH_DONE ? static_cast<T*>( this->item ) : nullptr; }
+
+        rgch_t m_ch;
+    };
+
+
+    /** Push item, suspend if Channel is full. */
+    push_op push( T* item ) { return push_op( m_ch, item ); }
+
+    /** Pop item, suspend if Channel is empty. */
+    pop_op pop() { return pop_op( m_ch ); }
+
+    /** Close Channel. */
+    void close() { rgch_close( m_ch ); }
+
+    /** Set executor for batched resume. */
+    void set_executor( rgch_exec_fn_t exec, void* ctx ) { rgch_set_executor( m_ch, exec, ctx ); }
+
+    /** Return item count. */
+    rg_size_t count() const { return rgch_count( m_ch ); }
+
+    /** Return C Channel. */
+    rgch_t get() const { return m_ch; }
+
+  private:
+    rgch_t m_ch;
+};
+
+}
+
+#endif
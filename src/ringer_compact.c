@@ -0,0 +1,150 @@
+/**
+ * @file   ringer_compact.c
+ * @author agent <agent@local>
+ * @date   Sun Oct 18 14:37:19 2026
+ *
+ * @brief  Compact Ringer with 32-bit indices.
+ *
+ */
+
+#include "ringer_compact.h"
+
+
+/* clang-format off */
+
+/** @cond ringer_none */
+#define rgc_true  1
+#define rgc_false 0
+#define rgc_nth( rc, idx )   rc->data[ ( idx ) & rc->mask ]
+/** @endcond ringer_none */
+
+/* clang-format on */
+
+
+static void rgc_setup( rgc_t rc, rgc_size_t size );
+
+
+
+/* ------------------------------------------------------------
+ * Compact Ringer:
+ */
+
+
+rgc_t rgc_new( rgc_size_t size )
+{
+    rgc_t      rc;
+    rgc_size_t pow;
+
+    if ( size > RGC_MAX_SIZE )
+        return NULL;
+
+    pow = RG_MIN_SIZE;
+    while ( pow < size )
+        pow <<= 1;
+
+    rc = (rgc_t)rg_malloc( RGC_BYTES( pow ) );
+    rgc_setup( rc, pow );
+
+    return rc;
+}
+
+
+rgc_t rgc_init( void* buf, size_t bytes )
+{
+    rgc_t      rc;
+    size_t     max;
+    rgc_size_t pow;
+
+    if ( bytes < RGC_BYTES( RG_MIN_SIZE ) )
+        return NULL;
+
+    max = ( bytes - sizeof( rgc_s ) ) / sizeof( void* );
+    pow = RG_MIN_SIZE;
+    while ( pow < RGC_MAX_SIZE && ( (size_t)pow << 1 ) <= max )
+        pow <<= 1;
+
+    rc = (rgc_t)buf;
+    rgc_setup( rc, pow );
+
+    return rc;
+}
+
+
+void rgc_destroy( rgc_p rcr )
+{
+    rg_free( *rcr );
+    *rcr = NULL;
+}
+
+
+int rgc_put( rgc_t rc, void* item )
+{
+    if ( !rgc_is_full( rc ) ) {
+        rgc_nth( rc, rc->widx ) = item;
+        rc->widx++;
+        return rgc_true;
+    } else
+        return rgc_false;
+}
+
+
+void* rgc_get( rgc_t rc )
+{
+    void* item;
+
+    if ( !rgc_is_empty( rc ) ) {
+        item = rgc_nth( rc, rc->ridx );
+        rc->ridx++;
+        return item;
+    } else
+        return NULL;
+}
+
+
+void* rgc_peek( rgc_t rc )
+{
+    if ( !rgc_is_empty( rc ) )
+        return rgc_nth( rc, rc->ridx );
+    else
+        return NULL;
+}
+
+
+rgc_size_t rgc_count( rgc_t rc )
+{
+    return rc->widx - rc->ridx;
+}
+
+
+int rgc_is_empty( rgc_t rc )
+{
+    return rc->widx == rc->ridx;
+}
+
+
+int rgc_is_full( rgc_t rc )
+{
+    return ( rc->widx - rc->ridx ) > rc->mask;
+}
+
+
+rgc_size_t rgc_size( rgc_t rc )
+{
+    return rc->mask + 1;
+}
+
+
+
+
+/* ------------------------------------------------------------
+ * Internal functions:
+ */
+
+
+static void rgc_setup( rgc_t rc, rgc_size_t size )
+{
+    rc->ridx = 0;
+    rc->widx = 0;
+    rc->mask = size - 1;
+    rc->spare = 0;
+}
@@ -0,0 +1,162 @@
+#ifndef RINGER_COMPACT_H
+#define RINGER_COMPACT_H
+
+/**
+ * @file   ringer_compact.h
+ * @author agent <agent@local>
+ * @date   Sun Oct 18 14:37:19 2026
+ *
+ * @brief  Compact Ringer with 32-bit indices.
+ *
+ * Compact Ringer is a fixed size Ringer for applications with a large
+ * number of small queues. Read and write indices are free running
+ * 32-bit counters, and item count is their difference. Hence the
+ * header is 16 bytes, instead of the 32 bytes of Ringer. Size is
+ * rounded up to power of two, so indices are masked to storage.
+ *
+ */
+
+#include "ringer.h"
+
+
+/** Compact Ringer size type. */
+typedef uint32_t rgc_size_t;
+
+
+/**
+ * Compact Ringer struct.
+ */
+struct rgc_struct_s
+{
+    rgc_size_t ridx;      /**< Read counter. */
+    rgc_size_t widx;      /**< Write counter. */
+    rgc_size_t mask;      /**< Index mask (size - 1). */
+    rgc_size_t spare;     /**< Unused (keeps data aligned). */
+    void*      data[ 0 ]; /**< Pointer array. */
+};
+typedef struct rgc_struct_s rgc_s; /**< Compact Ringer struct. */
+typedef rgc_s*              rgc_t; /**< Compact Ringer pointer. */
+typedef rgc_t*              rgc_p; /**< Compact Ringer pointer reference. */
+
+
+/** Maximum size of Compact Ringer. */
+#define RGC_MAX_SIZE ( (rgc_size_t)1 << 31 )
+
+
+/** Bytes needed for Compact Ringer of size (power of two). */
+#define RGC_BYTES( size ) ( sizeof( rgc_s ) + ( size ) * sizeof( void* ) )
+
+
+
+/* ------------------------------------------------------------
+ * Compact Ringer:
+ */
+
+
+/**
+ * Create Compact Ringer with size.
+ *
+ * Size is rounded up to power of two.
+ *
+ * @param size Size (at most RGC_MAX_SIZE).
+ *
+ * @return Compact Ringer (or NULL if size is too large).
+ */
+rgc_t rgc_new( rgc_size_t size );
+
+
+/**
+ * Initialize Compact Ringer to user storage.
+ *
+ * Size is the largest power of two that fits to the buffer. Buffer
+ * must be aligned for pointers, and it is not released by Compact
+ * Ringer.
+ *
+ * @param buf   Buffer.
+ * @param bytes Buffer size in bytes.
+ *
+ * @return Compact Ringer (or NULL if buffer is too small).
+ */
+rgc_t rgc_init( void* buf, size_t bytes );
+
+
+/**
+ * Destroy Compact Ringer.
+ *
+ * @param rcr Compact Ringer reference.
+ */
+void rgc_destroy( rgc_p rcr );
+
+
+/**
+ * Put item to Compact Ringer.
+ *
+ * @param rc   Compact Ringer.
+ * @param item Item.
+ *
+ * @return 1 on success (0 if full).
+ */
+int rgc_put( rgc_t rc, void* item );
+
+
+/**
+ * Get item from Compact Ringer.
+ *
+ * @param rc Compact Ringer.
+ *
+ * @return Item (or NULL if empty).
+ */
+void* rgc_get( rgc_t rc );
+
+
+/**
+ * Peek item from Compact Ringer.
+ *
+ * @param rc Compact Ringer.
+ *
+ * @return Item (or NULL if empty).
+ */
+void* rgc_peek( rgc_t rc );
+
+
+/**
+ * Return item count of Compact Ringer.
+ *
+ * @param rc Compact Ringer.
+ *
+ * @return Count.
+ */
+rgc_size_t rgc_count( rgc_t rc );
+
+
+/**
+ * Is Compact Ringer empty?
+ *
+ * @param rc Compact Ringer.
+ *
+ * @return 1 if empty.
+ */
+int rgc_is_empty( rgc_t rc );
+
+
+/**
+ * Is Compact Ringer full?
+ *
+ * @param rc Compact Ringer.
+ *
+ * @return 1 if full.
+ */
+int rgc_is_full( rgc_t rc );
+
+
+/**
+ * Return Compact Ringer storage size.
+ *
+ * @param rc Compact Ringer.
+ *
+ * @return Size.
+ */
+rgc_size_t rgc_size( rgc_t rc );
+
+
+#endif
@@ -0,0 +1,352 @@
+/**
+ * @file   ringer_fc.c
+ * @author agent <agent@local>
+ * @date   Sun Oct 18 14:39:53 2026
+ *
+ * @brief  Flat combining concurrent Ringer.
+ *
+ */
+
+#include <sched.h>
+#include "ringer_fc.h"
+
+
+/* clang-format off */
+
+/** @cond ringer_none */
+#define rgfc_struct_size(cnt) ( sizeof(rgfc_s) + cnt*sizeof(rgfc_slot_s) )
+#define rgfc_spin             64
+/** @endcond ringer_none */
+
+/* clang-format on */
+
+
+/** Operation codes. */
+enum rgfc_op_e {
+    RGFC_OP_NONE = 0,
+    RGFC_OP_PUT,
+    RGFC_OP_GET,
+    RGFC_OP_RAM,
+    RGFC_OP_PUT_FRONT,
+    RGFC_OP_GET_BACK,
+    RGFC_OP_PEEK,
+    RGFC_OP_PEEK_BACK,
+    RGFC_OP_GET_NTH,
+    RGFC_OP_COUNT,
+    RGFC_OP_IS_EMPTY,
+    RGFC_OP_IS_FULL,
+    RGFC_OP_SIZE,
+    RGFC_OP_RESIZE,
+};
+
+
+static void rgfc_exec( rgfc_t fc, int op, void** item, rg_pos_t pos, rg_size_t* ret );
+static rgfc_slot_s* rgfc_slot( rgfc_t fc );
+static void rgfc_release( void* slot );
+static int rgfc_try_lock( rgfc_t fc );
+static void rgfc_combine( rgfc_t fc );
+static void rgfc_apply( rgfc_t fc, int op, void** item, rg_pos_t pos, rg_size_t* ret );
+
+
+
+/* ------------------------------------------------------------
+ * Combining Ringer:
+ */
+
+
+rgfc_t rgfc_new( rg_size_t size, int slots )
+{
+    rgfc_t fc;
+
+    if ( slots <= 0 )
+        slots = RGFC_SLOTS;
+
+    fc = (rgfc_t)rg_malloc( rgfc_struct_size( slots ) );
+
+    if ( pthread_key_create( &fc->key, rgfc_release ) != 0 ) {
+        rg_free( fc );
+        return NULL;
+    }
+
+    atomic_init( &fc->lock, 0 );
+    fc->rg = rg_new( size );
+    fc->cnt = slots;
+
+    for ( int i = 0; i < slots; i++ ) {
+        atomic_init( &fc->slot[ i ].op, RGFC_OP_NONE );
+        atomic_init( &fc->slot[ i ].used, 0 );
+    }
+
+    return fc;
+}
+
+
+void rgfc_destroy( rgfc_p fcr )
+{
+    rgfc_t fc = *fcr;
+
+    pthread_key_delete( fc->key );
+    rg_destroy( &fc->rg );
+    rg_free( fc );
+    *fcr = NULL;
+}
+
+
+int rgfc_put( rgfc_t fc, void* item )
+{
+    rg_size_t ret;
+    rgfc_exec( fc, RGFC_OP_PUT, &item, 0, &ret );
+    return ret;
+}
+
+
+void* rgfc_get( rgfc_t fc )
+{
+    void*     item = NULL;
+    rg_size_t ret;
+    rgfc_exec( fc, RGFC_OP_GET, &item, 0, &ret );
+    return item;
+}
+
+
+int rgfc_ram( rgfc_t fc, void* item )
+{
+    rg_size_t ret;
+    rgfc_exec( fc, RGFC_OP_RAM, &item, 0, &ret );
+    return ret;
+}
+
+
+int rgfc_put_front( rgfc_t fc, void* item )
+{
+    rg_size_t ret;
+    rgfc_exec( fc, RGFC_OP_PUT_FRONT, &item, 0, &ret );
+    return ret;
+}
+
+
+void* rgfc_get_back( rgfc_t fc )
+{
+    void*     item = NULL;
+    rg_size_t ret;
+    rgfc_exec( fc, RGFC_OP_GET_BACK, &item, 0, &ret );
+    return item;
+}
+
+
+void* rgfc_peek( rgfc_t fc )
+{
+    void*     item = NULL;
+    rg_size_t ret;
+    rgfc_exec( fc, RGFC_OP_PEEK, &item, 0, &ret );
+    return item;
+}
+
+
+void* rgfc_peek_back( rgfc_t fc )
+{
+    void*     item = NULL;
+    rg_size_t ret;
+    rgfc_exec( fc, RGFC_OP_PEEK_BACK, &item, 0, &ret );
+    return item;
+}
+
+
+void* rgfc_get_nth( rgfc_t fc, rg_pos_t pos )
+{
+    void*     item = NULL;
+    rg_size_t ret;
+    rgfc_exec( fc, RGFC_OP_GET_NTH, &item, pos, &ret );
+    return item;
+}
+
+
+rg_size_t rgfc_count( rgfc_t fc )
+{
+    void*     item = NULL;
+    rg_size_t ret;
+    rgfc_exec( fc, RGFC_OP_COUNT, &item, 0, &ret );
+    return ret;
+}
+
+
+int rgfc_is_empty( rgfc_t fc )
+{
+    void*     item = NULL;
+    rg_size_t ret;
+    rgfc_exec( fc, RGFC_OP_IS_EMPTY, &item, 0, &ret );
+    return ret;
+}
+
+
+int rgfc_is_full( rgfc_t fc )
+{
+    void*     item = NULL;
+    rg_size_t ret;
+    rgfc_exec( fc, RGFC_OP_IS_FULL, &item, 0, &ret );
+    return ret;
+}
+
+
+rg_size_t rgfc_size( rgfc_t fc )
+{
+    void*     item = NULL;
+    rg_size_t ret;
+    rgfc_exec( fc, RGFC_OP_SIZE, &item, 0, &ret );
+    return ret;
+}
+
+
+int rgfc_resize( rgfc_t fc, rg_size_t size )
+{
+    void*     item = NULL;
+    rg_size_t ret;
+    rgfc_exec( fc, RGFC_OP_RESIZE, &item, (rg_pos_t)size, &ret );
+    return ret;
+}
+
+
+
+
+/* ------------------------------------------------------------
+ * Internal functions:
+ */
+
+
+/**
+ * Execute operation.
+ *
+ * Operation is published to the slot of the thread, and the thread
+ * waits until a combiner has applied it. Thread becomes the combiner
+ * itself, if the combiner lock is free.
+ */
+static void rgfc_exec( rgfc_t fc, int op, void** item, rg_pos_t pos, rg_size_t* ret )
+{
+    rgfc_slot_s* slot;
+    int          spin;
+
+    slot = rgfc_slot( fc );
+
+    if ( slot == NULL ) {
+
+        /* No slot, apply directly. */
+        while ( !rgfc_try_lock( fc ) )
+            sched_yield();
+        rgfc_apply( fc, op, item, pos, ret );
+        atomic_store_explicit( &fc->lock, 0, memory_order_release );
+        return;
+    }
+
+    slot->item = *item;
+    slot->pos = pos;
+    atomic_store_explicit( &slot->op, op, memory_order_release );
+
+    spin = 0;
+    while ( atomic_load_explicit( &slot->op, memory_order_acquire ) != RGFC_OP_NONE ) {
+
+        if ( rgfc_try_lock( fc ) ) {
+            rgfc_combine( fc );
+            atomic_store_explicit( &fc->lock, 0, memory_order_release );
+        } else if ( ++spin >= rgfc_spin ) {
+            spin = 0;
+            sched_yield();
+        }
+    }
+
+    *item = slot->item;
+    *ret = slot->ret;
+}
+
+
+/**
+ * Return slot of current thread.
+ *
+ * Free slot is claimed at the first operation of the thread.
+ *
+ * @return Slot (or NULL if all slots are taken).
+ */
+static rgfc_slot_s* rgfc_slot( rgfc_t fc )
+{
+    rgfc_slot_s* slot;
+    int          free;
+
+    slot = (rgfc_slot_s*)pthread_getspecific( fc->key );
+
+    if ( slot == NULL ) {
+        for ( int i = 0; i < fc->cnt; i++ ) {
+            free = 0;
+            if ( atomic_compare_exchange_strong( &fc->slot[ i ].used, &free, 1 ) ) {
+                slot = &fc->slot[ i ];
+                pthread_setspecific( fc->key, slot );
+                break;
+            }
+        }
+    }
+
+    return slot;
+}
+
+
+/**
+ * Release slot at thread exit.
+ */
+static void rgfc_release( void* slot )
+{
+    atomic_store( &( (rgfc_slot_s*)slot )->used, 0 );
+}
+
+
+static int rgfc_try_lock( rgfc_t fc )
+{
+    return ( atomic_load_explicit( &fc->lock, memory_order_relaxed ) == 0
+             && atomic_exchange_explicit( &fc->lock, 1, memory_order_acquire ) == 0 );
+}
+
+
+/**
+ * Apply all published operations.
+ */
+static void rgfc_combine( rgfc_t fc )
+{
+    rgfc_slot_s* slot;
+    int          op;
+
+    for ( int i = 0; i < fc->cnt; i++ ) {
+
+        slot = &fc->slot[ i ];
+        op = atomic_load_explicit( &slot->op, memory_order_acquire );
+
+        if ( op != RGFC_OP_NONE ) {
+            rgfc_apply( fc, op, &slot->item, slot->pos, &slot->ret );
+            atomic_store_explicit( &slot->op, RGFC_OP_NONE, memory_order_release );
+        }
+    }
+}
+
+
+/**
+ * Apply operation to Ringer.
+ */
+static void rgfc_apply( rgfc_t fc, int op, void** item, rg_pos_t pos, rg_size_t* ret )
+{
+    rg_t rg = fc->rg;
+
+    *ret = 0;
+
+    switch ( op ) {
+        case RGFC_OP_PUT: *ret = rg_put( rg, *item ); break;
+        case RGFC_OP_GET: *item = rg_get( rg ); break;
+        case RGFC_OP_RAM: *ret = rg_ram( &fc->rg, *item ); break;
+        case RGFC_OP_PUT_FRONT: *ret = rg_put_front( rg, *item ); break;
+        case RGFC_OP_GET_BACK: *item = rg_get_back( rg ); break;
+        case RGFC_OP_PEEK: *item = rg_peek( rg ); break;
+        case RGFC_OP_PEEK_BACK: *item = rg_peek_back( rg ); break;
+        case RGFC_OP_GET_NTH: *item = rg_get_nth( rg, pos ); break;
+        case RGFC_OP_COUNT: *ret = rg_count( rg ); break;
+        case RGFC_OP_IS_EMPTY: *ret = rg_is_empty( rg ); break;
+        case RGFC_OP_IS_FULL: *ret = rg_is_full( rg ); break;
+        case RGFC_OP_SIZE: *ret = rg_size( rg ); break;
+        case RGFC_OP_RESIZE: *ret = rg_resize( &fc->rg, (rg_size_t)pos ); break;
+        default: break;
+    }
+}
@@ -0,0 +1,241 @@
+#ifndef RINGER_FC_H
+#define RINGER_FC_H
+
+/**
+ * @file   ringer_fc.h
+ * @author agent <agent@local>
+ * @date   Sun Oct 18 14:39:53 2026
+ *
+ * @brief  Flat combining concurrent Ringer.
+ *
+ * Combining Ringer makes all Ringer operations thread safe. Thread
+ * publishes its operation to its own slot, and the thread that holds
+ * the combiner lock applies all published operations to Ringer as a
+ * batch. Hence Ringer stays in the cache of the combiner, and the
+ * lock is taken once per batch instead of once per operation.
+ *
+ * Thread gets a slot at its first operation, and the slot is released
+ * when the thread exits. If all slots are taken, operation is applied
+ * directly under the combiner lock.
+ *
+ */
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include "ringer.h"
+
+
+/** Cache line size for separating shared data. */
+#define RGFC_CACHE_LINE 64
+
+/** Default slot count. */
+#define RGFC_SLOTS 64
+
+
+/**
+ * Operation slot.
+ */
+struct rgfc_slot_s
+{
+    atomic_int op;   /**< Pending operation (0 if none). */
+    atomic_int used; /**< Slot owned by thread. */
+    void*      item; /**< Item argument or result. */
+    rg_pos_t   pos;  /**< Position or size argument. */
+    rg_size_t  ret;  /**< Integer result. */
+    /** @cond ringer_none */
+    char pad[ RGFC_CACHE_LINE - 2 * sizeof( atomic_int ) - sizeof( void* ) - sizeof( rg_pos_t )
+              - sizeof( rg_size_t ) ];
+    /** @endcond ringer_none */
+};
+typedef struct rgfc_slot_s rgfc_slot_s; /**< Operation slot struct. */
+
+
+/**
+ * Combining Ringer struct.
+ */
+struct rgfc_struct_s
+{
+    atomic_int lock; /**< Combiner lock. */
+    /** @cond ringer_none */
+    char pad[ RGFC_CACHE_LINE - sizeof( atomic_int ) ];
+    /** @endcond ringer_none */
+    rg_t          rg;         /**< Ringer (accessed by combiner). */
+    int           cnt;        /**< Slot count. */
+    pthread_key_t key;        /**< Thread slot key. */
+    rgfc_slot_s   slot[ 0 ];  /**< Operation slots. */
+};
+typedef struct rgfc_struct_s rgfc_s; /**< Combining Ringer struct. */
+typedef rgfc_s*              rgfc_t; /**< Combining Ringer pointer. */
+typedef rgfc_t*              rgfc_p; /**< Combining Ringer pointer reference. */
+
+
+
+/* ------------------------------------------------------------
+ * Combining Ringer:
+ */
+
+
+/**
+ * Create Combining Ringer.
+ *
+ * @param size  Ringer size.
+ * @param slots Slot count, i.e. number of combined threads (0 for
+ *              RGFC_SLOTS).
+ *
+ * @return Combining Ringer (or NULL if thread key can't be created).
+ */
+rgfc_t rgfc_new( rg_size_t size, int slots );
+
+
+/**
+ * Destroy Combining Ringer.
+ *
+ * All threads must have stopped using Combining Ringer.
+ *
+ * @param fcr Combining Ringer reference.
+ */
+void rgfc_destroy( rgfc_p fcr );
+
+
+/**
+ * Put item to Combining Ringer.
+ *
+ * @param fc   Combining Ringer.
+ * @param item Item.
+ *
+ * @return 1 on success (0 if full).
+ */
+int rgfc_put( rgfc_t fc, void* item );
+
+
+/**
+ * Get item from Combining Ringer.
+ *
+ * @param fc Combining Ringer.
+ *
+ * @return Item (or NULL if empty).
+ */
+void* rgfc_get( rgfc_t fc );
+
+
+/**
+ * Forcefully put item to Combining Ringer.
+ *
+ * Ringer is resized to double, if full.
+ *
+ * @param fc   Combining Ringer.
+ * @param item Item.
+ *
+ * @return 1 if resized (else 0).
+ */
+int rgfc_ram( rgfc_t fc, void* item );
+
+
+/**
+ * Put item to front of Combining Ringer.
+ *
+ * @param fc   Combining Ringer.
+ * @param item Item.
+ *
+ * @return 1 on success (0 if full).
+ */
+int rgfc_put_front( rgfc_t fc, void* item );
+
+
+/**
+ * Get item from back of Combining Ringer.
+ *
+ * @param fc Combining Ringer.
+ *
+ * @return Item (or NULL if empty).
+ */
+void* rgfc_get_back( rgfc_t fc );
+
+
+/**
+ * Peek item from Combining Ringer.
+ *
+ * @param fc Combining Ringer.
+ *
+ * @return Item (or NULL if empty).
+ */
+void* rgfc_peek( rgfc_t fc );
+
+
+/**
+ * Peek item from back of Combining Ringer.
+ *
+ * @param fc Combining Ringer.
+ *
+ * @return Item (or NULL if empty).
+ */
+void* rgfc_peek_back( rgfc_t fc );
+
+
+/**
+ * Get nth item from Combining Ringer.
+ *
+ * See rg_get_nth().
+ *
+ * @param fc  Combining Ringer.
+ * @param pos Offset from Read Index.
+ *
+ * @return Item (or NULL).
+ */
+void* rgfc_get_nth( rgfc_t fc, rg_pos_t pos );
+
+
+/**
+ * Return item count of Combining Ringer.
+ *
+ * @param fc Combining Ringer.
+ *
+ * @return Count.
+ */
+rg_size_t rgfc_count( rgfc_t fc );
+
+
+/**
+ * Is Combining Ringer empty?
+ *
+ * @param fc Combining Ringer.
+ *
+ * @return 1 if empty.
+ */
+int rgfc_is_empty( rgfc_t fc );
+
+
+/**
+ * Is Combining Ringer full?
+ *
+ * @param fc Combining Ringer.
+ *
+ * @return 1 if full.
+ */
+int rgfc_is_full( rgfc_t fc );
+
+
+/**
+ * Return Combining Ringer storage size.
+ *
+ * @param fc Combining Ringer.
+ *
+ * @return Size.
+ */
+rg_size_t rgfc_size( rgfc_t fc );
+
+
+/**
+ * Resize Combining Ringer to size.
+ *
+ * See rg_resize().
+ *
+ * @param fc   Combining Ringer.
+ * @param size New size.
+ *
+ * @return 1 on success (else 0).
+ */
+int rgfc_resize( rgfc_t fc, rg_size_t size );
+
+
+#endif
@@ -0,0 +1,346 @@
+/**
+ * @file   ringer_file.c
+ * @author agent <agent@local>
+ * @date   Sun Oct 18 14:21:18 2026
+ *
+ * @brief  File backed Ringer for fixed size records.
+ *
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "ringer_file.h"
+
+
+/* clang-format off */
+
+/** @cond ringer_none */
+#define rgf_true          1
+#define rgf_false         0
+#define rgf_magic         0x524746494c453031ULL
+#define rgf_slot_offset   ( RGF_HEAD_SIZE / 2 )
+#define rgf_slot( rf, n ) ( (rgf_head_t)( rf->map + ( n ) * rgf_slot_offset ) )
+#define rgf_nth( rf, pos ) ( rf->data + ( pos ) * rf->rsize )
+/** @endcond ringer_none */
+
+/* clang-format on */
+
+
+/**
+ * File Ringer header.
+ *
+ * Header is stored in two slots. rgf_sync() writes the slot that does
+ * not hold the latest header, and recovery selects the valid header
+ * with highest sequence number. Hence an interrupted sync can only
+ * lose the sync itself.
+ */
+struct rgf_head_s
+{
+    uint64_t  magic; /**< File identification. */
+    uint64_t  seq;   /**< Sync sequence number. */
+    rg_size_t ridx;  /**< Read index. */
+    rg_size_t widx;  /**< Write index. */
+    rg_size_t cnt;   /**< Item count. */
+    rg_size_t size;  /**< Size (as records). */
+    rg_size_t rsize; /**< Record size. */
+    uint64_t  sum;   /**< Checksum of the fields above. */
+};
+typedef struct rgf_head_s rgf_head_s;
+typedef rgf_head_s*       rgf_head_t;
+
+
+static uint64_t rgf_checksum( rgf_head_t head );
+static int rgf_head_valid( rgf_head_t head, rg_size_t len );
+static int rgf_head_blank( rgf_t rf );
+static int rgf_write_head( rgf_t rf );
+static rg_size_t rgf_next_index( rg_size_t size, rg_size_t idx );
+
+
+
+/* ------------------------------------------------------------
+ * File Ringer:
+ */
+
+
+rgf_t rgf_open( const char* path, rg_size_t size, rg_size_t rsize )
+{
+    int         fd;
+    struct stat st;
+    size_t      len;
+    char*       map;
+    rgf_head_t  head;
+    rgf_t       rf;
+    int         fresh;
+
+    if ( rsize == 0 )
+        return NULL;
+
+    fd = open( path, O_RDWR | O_CREAT, 0644 );
+    if ( fd < 0 )
+        return NULL;
+
+    if ( fstat( fd, &st ) != 0 )
+        goto fail_fd;
+
+    fresh = ( st.st_size == 0 );
+
+    if ( fresh ) {
+        if ( size < RG_MIN_SIZE || size > ( SIZE_MAX - RGF_HEAD_SIZE ) / rsize )
+            goto fail_fd;
+        len = RGF_HEAD_SIZE + size * rsize;
+        if ( ftruncate( fd, len ) != 0 )
+            goto fail_fd;
+    } else {
+        len = st.st_size;
+        if ( len < RGF_HEAD_SIZE )
+            goto fail_fd;
+    }
+
+    map = mmap( NULL, len, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 );
+    if ( map == MAP_FAILED )
+        goto fail_fd;
+
+    rf = (rgf_t)rg_malloc( sizeof( rgf_s ) );
+    rf->fd = fd;
+    rf->len = len;
+    rf->map = map;
+    rf->data = map + RGF_HEAD_SIZE;
+    rf->held = 0;
+
+    if ( !fresh ) {
+
+        /* Recover from the latest valid header. */
+        head = NULL;
+        for ( int i = 0; i < 2; i++ ) {
+            if ( rgf_head_valid( rgf_slot( rf, i ), len )
+                 && ( head == NULL || rgf_slot( rf, i )->seq > head->seq ) )
+                head = rgf_slot( rf, i );
+        }
+
+        if ( head ) {
+            if ( head->rsize != rsize )
+                goto fail_map;
+
+            rf->ridx = head->ridx;
+            rf->widx = head->widx;
+            rf->cnt = head->cnt;
+            rf->size = head->size;
+            rf->rsize = head->rsize;
+            rf->seq = head->seq;
+
+        } else if ( rgf_head_blank( rf ) && size >= RG_MIN_SIZE
+                    && size <= ( SIZE_MAX - RGF_HEAD_SIZE ) / rsize
+                    && len == RGF_HEAD_SIZE + size * rsize ) {
+
+            /* Created, but first header was never written. */
+            fresh = rgf_true;
+
+        } else {
+            goto fail_map;
+        }
+    }
+
+    if ( fresh ) {
+
+        /* New file, seq 0 is reserved for "no header". */
+        rf->ridx = 0;
+        rf->widx = 0;
+        rf->cnt = 0;
+        rf->size = size;
+        rf->rsize = rsize;
+        rf->seq = 0;
+        if ( !rgf_write_head( rf ) )
+            goto fail_map;
+    }
+
+    return rf;
+
+fail_map:
+    munmap( map, len );
+    rg_free( rf );
+fail_fd:
+    close( fd );
+    return NULL;
+}
+
+
+int rgf_close( rgf_p rfr )
+{
+    rgf_t rf = *rfr;
+    int   ret;
+
+    ret = rgf_sync( rf );
+    if ( munmap( rf->map, rf->len ) != 0 )
+        ret = rgf_false;
+    if ( close( rf->fd ) != 0 )
+        ret = rgf_false;
+    rg_free( rf );
+    *rfr = NULL;
+
+    return ret;
+}
+
+
+int rgf_sync( rgf_t rf )
+{
+    /* Records must be on disk before the header refers to them. */
+    if ( msync( rf->map, rf->len, MS_SYNC ) != 0 )
+        return rgf_false;
+
+    if ( !rgf_write_head( rf ) )
+        return rgf_false;
+
+    rf->held = 0;
+
+    return rgf_true;
+}
+
+
+int rgf_put( rgf_t rf, const void* rec )
+{
+    if ( !rgf_is_full( rf ) ) {
+        memcpy( rgf_nth( rf, rf->widx ), rec, rf->rsize );
+        rf->widx = rgf_next_index( rf->size, rf->widx );
+        rf->cnt++;
+        return rgf_true;
+    } else
+        return rgf_false;
+}
+
+
+int rgf_get( rgf_t rf, void* rec )
+{
+    if ( !rgf_is_empty( rf ) ) {
+        if ( rec )
+            memcpy( rec, rgf_nth( rf, rf->ridx ), rf->rsize );
+        rf->ridx = rgf_next_index( rf->size, rf->ridx );
+        rf->cnt--;
+        rf->held++;
+        return rgf_true;
+    } else
+        return rgf_false;
+}
+
+
+const void* rgf_peek( rgf_t rf )
+{
+    if ( !rgf_is_empty( rf ) )
+        return rgf_nth( rf, rf->ridx );
+    else
+        return NULL;
+}
+
+
+rg_size_t rgf_count( rgf_t rf )
+{
+    return rf->cnt;
+}
+
+
+int rgf_is_empty( rgf_t rf )
+{
+    return rf->cnt == 0;
+}
+
+
+int rgf_is_full( rgf_t rf )
+{
+    /*
+     * Slots of records got after last sync are still referred by the
+     * header in file, and they must not be overwritten.
+     */
+    return ( rf->cnt + rf->held >= rf->size );
+}
+
+
+rg_size_t rgf_size( rgf_t rf )
+{
+    return rf->size;
+}
+
+
+
+
+/* ------------------------------------------------------------
+ * Internal functions:
+ */
+
+
+static uint64_t rgf_checksum( rgf_head_t head )
+{
+    /* FNV-1a over header fields. */
+    const uint8_t* p = (const uint8_t*)head;
+    uint64_t       sum = 0xcbf29ce484222325ULL;
+
+    for ( size_t i = 0; i < offsetof( rgf_head_s, sum ); i++ ) {
+        sum ^= p[ i ];
+        sum *= 0x100000001b3ULL;
+    }
+
+    return sum;
+}
+
+
+static int rgf_head_valid( rgf_head_t head, rg_size_t len )
+{
+    return ( head->magic == rgf_magic && head->seq != 0 && head->sum == rgf_checksum( head )
+             && head->size >= RG_MIN_SIZE && head->rsize > 0
+             && head->size <= ( len - RGF_HEAD_SIZE ) / head->rsize && head->ridx < head->size
+             && head->widx < head->size && head->cnt <= head->size );
+}
+
+
+/**
+ * Are both header slots unwritten (all zero)?
+ */
+static int rgf_head_blank( rgf_t rf )
+{
+    for ( size_t i = 0; i < RGF_HEAD_SIZE; i++ )
+        if ( rf->map[ i ] != 0 )
+            return rgf_false;
+
+    return rgf_true;
+}
+
+
+/**
+ * Write header to the slot not holding the latest durable header.
+ *
+ * Sequence number advances only when the header is on disk, so a
+ * failed write is retried to the same slot.
+ */
+static int rgf_write_head( rgf_t rf )
+{
+    rgf_head_t head;
+    uint64_t   seq;
+
+    seq = rf->seq + 1;
+    head = rgf_slot( rf, seq % 2 );
+
+    head->magic = rgf_magic;
+    head->seq = seq;
+    head->ridx = rf->ridx;
+    head->widx = rf->widx;
+    head->cnt = rf->cnt;
+    head->size = rf->size;
+    head->rsize = rf->rsize;
+    head->sum = rgf_checksum( head );
+
+    if ( msync( rf->map, RGF_HEAD_SIZE, MS_SYNC ) != 0 )
+        return rgf_false;
+
+    rf->seq = seq;
+
+    return rgf_true;
+}
+
+
+static rg_size_t rgf_next_index( rg_size_t size, rg_size_t idx )
+{
+    return ( ( rg_size_t )( idx + 1 ) ) % size;
+}
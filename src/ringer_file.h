@@ -0,0 +1,172 @@
+#ifndef RINGER_FILE_H
+#define RINGER_FILE_H
+
+/**
+ * @file   ringer_file.h
+ * @author agent <agent@local>
+ * @date   Sun Oct 18 14:21:18 2026
+ *
+ * @brief  File backed Ringer for fixed size records.
+ *
+ * File Ringer stores records in a memory mapped file. Ringer state
+ * is written to the file only by rgf_sync(), after the records have
+ * been flushed. Hence the file always describes a consistent Ringer,
+ * which is recovered when the file is opened again.
+ *
+ */
+
+#include "ringer.h"
+
+
+/** File Ringer header size (file offset to records). */
+#define RGF_HEAD_SIZE 4096
+
+
+/**
+ * File Ringer struct.
+ */
+struct rgf_struct_s
+{
+    rg_size_t ridx;  /**< Read index. */
+    rg_size_t widx;  /**< Write index. */
+    rg_size_t cnt;   /**< Item count. */
+    rg_size_t size;  /**< Reservation size for data (records). */
+    rg_size_t rsize; /**< Record size in bytes. */
+    rg_size_t held;  /**< Records got after last sync. */
+    uint64_t  seq;   /**< Sync sequence number. */
+    int       fd;    /**< File descriptor. */
+    size_t    len;   /**< Mapping length. */
+    char*     map;   /**< File mapping. */
+    char*     data;  /**< Record storage. */
+};
+typedef struct rgf_struct_s rgf_s; /**< File Ringer struct. */
+typedef rgf_s*              rgf_t; /**< File Ringer pointer. */
+typedef rgf_t*              rgf_p; /**< File Ringer pointer reference. */
+
+
+
+/* ------------------------------------------------------------
+ * File Ringer:
+ */
+
+
+/**
+ * Open File Ringer.
+ *
+ * New file is created and initialized, if file does not exist or it
+ * is empty. File that was created with the same size, but whose first
+ * header was never written, is also initialized. Existing file is recovered to the state of the latest
+ * rgf_sync(). Recovery uses the size stored in file, hence size is
+ * only used for new files.
+ *
+ * @param path  File path.
+ * @param size  Size (as records) for new file.
+ * @param rsize Record size in bytes.
+ *
+ * @return File Ringer (or NULL on failure).
+ */
+rgf_t rgf_open( const char* path, rg_size_t size, rg_size_t rsize );
+
+
+/**
+ * Close File Ringer.
+ *
+ * File Ringer is synced before closing.
+ *
+ * @param rfr File Ringer reference.
+ *
+ * @return 1 on success (else 0).
+ */
+int rgf_close( rgf_p rfr );
+
+
+/**
+ * Sync File Ringer to file.
+ *
+ * Records are flushed before Ringer state. Space released by
+ * rgf_get() becomes available for rgf_put() after sync.
+ *
+ * @param rf File Ringer.
+ *
+ * @return 1 on success (else 0).
+ */
+int rgf_sync( rgf_t rf );
+
+
+/**
+ * Put record to File Ringer.
+ *
+ * @param rf  File Ringer.
+ * @param rec Record (record size bytes).
+ *
+ * @return 1 on success (0 if full).
+ */
+int rgf_put( rgf_t rf, const void* rec );
+
+
+/**
+ * Get record from File Ringer.
+ *
+ * @param rf  File Ringer.
+ * @param rec Record storage (or NULL to discard).
+ *
+ * @return 1 on success (0 if empty).
+ */
+int rgf_get( rgf_t rf, void* rec );
+
+
+/**
+ * Peek record from File Ringer.
+ *
+ * No changes to Ringer state.
+ *
+ * @param rf File Ringer.
+ *
+ * @return Record within file mapping (or NULL if empty).
+ */
+const void* rgf_peek( rgf_t rf );
+
+
+/**
+ * Return record count of File Ringer.
+ *
+ * @param rf File Ringer.
+ *
+ * @return Count.
+ */
+rg_size_t rgf_count( rgf_t rf );
+
+
+/**
+ * Is File Ringer empty?
+ *
+ * @param rf File Ringer.
+ *
+ * @return 1 if empty.
+ */
+int rgf_is_empty( rgf_t rf );
+
+
+/**
+ * Is File Ringer full?
+ *
+ * Records got after last sync are included.
+ *
+ * @param rf File Ringer.
+ *
+ * @return 1 if full.
+ */
+int rgf_is_full( rgf_t rf );
+
+
+/**
+ * Return File Ringer storage size.
+ *
+ * @param rf File Ringer.
+ *
+ * @return Size (as records).
+ */
+rg_size_t rgf_size( rgf_t rf );
+
+
+#endif
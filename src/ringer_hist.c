@@ -0,0 +1,218 @@
+/**
+ * @file   ringer_hist.c
+ * @author agent <agent@local>
+ * @date   Sun Oct 18 14:43:19 2026
+ *
+ * @brief  Log-linear histogram for Ringer dwell times.
+ *
+ */
+
+#include "ringer_hist.h"
+
+
+/* clang-format off */
+
+/** @cond ringer_none */
+#define rgh_load( var )        atomic_load_explicit( &( var ), memory_order_relaxed )
+#define rgh_add( var, val )    atomic_fetch_add_explicit( &( var ), ( val ), memory_order_relaxed )
+#define rgh_set( var, val )    atomic_store_explicit( &( var ), ( val ), memory_order_relaxed )
+/** @endcond ringer_none */
+
+/* clang-format on */
+
+
+static int rgh_index( rg_size_t value );
+static rg_size_t rgh_upper( int idx );
+static void rgh_raise( _Atomic rg_size_t* max, rg_size_t value );
+
+
+
+/* ------------------------------------------------------------
+ * Histogram:
+ */
+
+
+rgh_t rgh_new( void )
+{
+    rgh_t h;
+
+    h = (rgh_t)rg_malloc( sizeof( rgh_s ) );
+    atomic_init( &h->cnt, 0 );
+    atomic_init( &h->sum, 0 );
+    atomic_init( &h->max, 0 );
+    for ( int i = 0; i < RGH_BUCKETS; i++ )
+        atomic_init( &h->bucket[ i ], 0 );
+
+    return h;
+}
+
+
+void rgh_destroy( rgh_p hr )
+{
+    rg_free( *hr );
+    *hr = NULL;
+}
+
+
+void rgh_record( rgh_t h, rg_size_t value )
+{
+    rgh_add( h->bucket[ rgh_index( value ) ], 1 );
+    rgh_add( h->cnt, 1 );
+    rgh_add( h->sum, value );
+    if ( value > rgh_load( h->max ) )
+        rgh_raise( &h->max, value );
+}
+
+
+void rgh_dwell( rg_t rg, rg_size_t ns, void* ctx )
+{
+    (void)rg;
+    rgh_record( (rgh_t)ctx, ns );
+}
+
+
+void rgh_snapshot( rgh_t h, rgh_t snap )
+{
+    rgh_set( snap->cnt, rgh_load( h->cnt ) );
+    rgh_set( snap->sum, rgh_load( h->sum ) );
+    rgh_set( snap->max, rgh_load( h->max ) );
+    for ( int i = 0; i < RGH_BUCKETS; i++ )
+        rgh_set( snap->bucket[ i ], rgh_load( h->bucket[ i ] ) );
+}
+
+
+void rgh_merge( rgh_t dst, rgh_t src )
+{
+    rg_size_t cnt;
+
+    for ( int i = 0; i < RGH_BUCKETS; i++ ) {
+        cnt = rgh_load( src->bucket[ i ] );
+        if ( cnt )
+            rgh_add( dst->bucket[ i ], cnt );
+    }
+
+    rgh_add( dst->cnt, rgh_load( src->cnt ) );
+    rgh_add( dst->sum, rgh_load( src->sum ) );
+    rgh_raise( &dst->max, rgh_load( src->max ) );
+}
+
+
+void rgh_reset( rgh_t h )
+{
+    for ( int i = 0; i < RGH_BUCKETS; i++ )
+        rgh_set( h->bucket[ i ], 0 );
+    rgh_set( h->cnt, 0 );
+    rgh_set( h->sum, 0 );
+    rgh_set( h->max, 0 );
+}
+
+
+rg_size_t rgh_count( rgh_t h )
+{
+    return rgh_load( h->cnt );
+}
+
+
+rg_size_t rgh_mean( rgh_t h )
+{
+    rg_size_t cnt = rgh_load( h->cnt );
+
+    return cnt ? rgh_load( h->sum ) / cnt : 0;
+}
+
+
+rg_size_t rgh_max( rgh_t h )
+{
+    return rgh_load( h->max );
+}
+
+
+rg_size_t rgh_percentile( rgh_t h, double pct )
+{
+    rg_size_t total;
+    rg_size_t want;
+    rg_size_t seen;
+    rg_size_t max;
+    rg_size_t upper;
+
+    /* Total from buckets, consistent with the scan below. */
+    total = 0;
+    for ( int i = 0; i < RGH_BUCKETS; i++ )
+        total += rgh_load( h->bucket[ i ] );
+
+    if ( total == 0 )
+        return 0;
+
+    want = (rg_size_t)( pct / 100.0 * total + 0.5 );
+    if ( want < 1 )
+        want = 1;
+    if ( want > total )
+        want = total;
+
+    max = rgh_load( h->max );
+    seen = 0;
+
+    for ( int i = 0; i < RGH_BUCKETS; i++ ) {
+        seen += rgh_load( h->bucket[ i ] );
+        if ( seen >= want ) {
+            upper = rgh_upper( i );
+            return ( upper < max ) ? upper : max;
+        }
+    }
+
+    return max;
+}
+
+
+
+
+/* ------------------------------------------------------------
+ * Internal functions:
+ */
+
+
+/**
+ * Return bucket index for value.
+ *
+ * Values below RGH_SUB map directly. Larger values map by exponent
+ * and the RGH_SUB_BITS bits below the leading one.
+ */
+static int rgh_index( rg_size_t value )
+{
+    int exp;
+
+    if ( value < RGH_SUB )
+        return (int)value;
+
+    exp = 63 - __builtin_clzll( value );
+
+    return ( exp - RGH_SUB_BITS + 1 ) * RGH_SUB + (int)( ( value >> ( exp - RGH_SUB_BITS ) ) & ( RGH_SUB - 1 ) );
+}
+
+
+/**
+ * Return largest value of bucket.
+ */
+static rg_size_t rgh_upper( int idx )
+{
+    int       exp;
+    rg_size_t base;
+
+    if ( idx < RGH_SUB )
+        return idx;
+
+    exp = idx / RGH_SUB + RGH_SUB_BITS - 1;
+    base = ( (rg_size_t)1 << exp ) + ( (rg_size_t)( idx % RGH_SUB ) << ( exp - RGH_SUB_BITS ) );
+
+    return base + ( ( (rg_size_t)1 << ( exp - RGH_SUB_BITS ) ) - 1 );
+}
+
+
+static void rgh_raise( _Atomic rg_size_t* max, rg_size_t value )
+{
+    rg_size_t cur = atomic_load_explicit( max, memory_order_relaxed );
+
+    while ( value > cur
+            && !atomic_compare_exchange_weak_explicit( max, &cur, value, memory_order_relaxed, memory_order_relaxed ) )
+        ;
+}
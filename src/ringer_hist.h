@@ -0,0 +1,168 @@
+#ifndef RINGER_HIST_H
+#define RINGER_HIST_H
+
+/**
+ * @file   ringer_hist.h
+ * @author agent <agent@local>
+ * @date   Sun Oct 18 14:43:19 2026
+ *
+ * @brief  Log-linear histogram for Ringer dwell times.
+ *
+ * Histogram has RGH_SUB buckets per power of two, hence relative
+ * error of a recorded value is below 1/RGH_SUB. Values below RGH_SUB
+ * are exact.
+ *
+ * Counters are atomic, so multiple threads can record to the same
+ * histogram, and histograms can be merged while recording continues.
+ * Histogram is attached to Ringer with:
+ *
+ *     rg_set_dwell( rg, rgh_dwell, hist );
+ *
+ */
+
+#include <stdatomic.h>
+#include "ringer.h"
+
+
+/** Sub-bucket bits (buckets per power of two). */
+#define RGH_SUB_BITS 4
+
+/** Buckets per power of two. */
+#define RGH_SUB ( 1 << RGH_SUB_BITS )
+
+/** Bucket count (64-bit values). */
+#define RGH_BUCKETS ( ( 64 - RGH_SUB_BITS + 1 ) * RGH_SUB )
+
+
+/**
+ * Histogram struct.
+ */
+struct rgh_struct_s
+{
+    _Atomic rg_size_t cnt;                   /**< Value count. */
+    _Atomic rg_size_t sum;                   /**< Value sum. */
+    _Atomic rg_size_t max;                   /**< Maximum value. */
+    _Atomic rg_size_t bucket[ RGH_BUCKETS ]; /**< Bucket counts. */
+};
+typedef struct rgh_struct_s rgh_s; /**< Histogram struct. */
+typedef rgh_s*              rgh_t; /**< Histogram pointer. */
+typedef rgh_t*              rgh_p; /**< Histogram pointer reference. */
+
+
+
+/* ------------------------------------------------------------
+ * Histogram:
+ */
+
+
+/**
+ * Create empty Histogram.
+ *
+ * @return Histogram.
+ */
+rgh_t rgh_new( void );
+
+
+/**
+ * Destroy Histogram.
+ *
+ * @param hr Histogram reference.
+ */
+void rgh_destroy( rgh_p hr );
+
+
+/**
+ * Record value to Histogram.
+ *
+ * @param h     Histogram.
+ * @param value Value.
+ */
+void rgh_record( rgh_t h, rg_size_t value );
+
+
+/**
+ * Record dwell time to Histogram.
+ *
+ * Dwell time callback for rg_set_dwell(), with Histogram as context.
+ *
+ * @param rg  Ringer.
+ * @param ns  Dwell time.
+ * @param ctx Histogram.
+ */
+void rgh_dwell( rg_t rg, rg_size_t ns, void* ctx );
+
+
+/**
+ * Take snapshot of Histogram.
+ *
+ * Snapshot is a copy taken counter by counter, i.e. values recorded
+ * during the copy may be partially included.
+ *
+ * @param h    Histogram.
+ * @param snap Snapshot Histogram (overwritten).
+ */
+void rgh_snapshot( rgh_t h, rgh_t snap );
+
+
+/**
+ * Add counts of source Histogram to destination Histogram.
+ *
+ * @param dst Destination Histogram.
+ * @param src Source Histogram.
+ */
+void rgh_merge( rgh_t dst, rgh_t src );
+
+
+/**
+ * Reset Histogram to empty.
+ *
+ * @param h Histogram.
+ */
+void rgh_reset( rgh_t h );
+
+
+/**
+ * Return value count of Histogram.
+ *
+ * @param h Histogram.
+ *
+ * @return Count.
+ */
+rg_size_t rgh_count( rgh_t h );
+
+
+/**
+ * Return mean value of Histogram.
+ *
+ * @param h Histogram.
+ *
+ * @return Mean (0 if empty).
+ */
+rg_size_t rgh_mean( rgh_t h );
+
+
+/**
+ * Return maximum value of Histogram.
+ *
+ * @param h Histogram.
+ *
+ * @return Maximum.
+ */
+rg_size_t rgh_max( rgh_t h );
+
+
+/**
+ * Return percentile of Histogram.
+ *
+ * Value is the upper bound of the bucket that contains the
+ * percentile, limited to maximum value.
+ *
+ * @param h   Histogram.
+ * @param pct Percentile (0.0 - 100.0).
+ *
+ * @return Value (0 if empty).
+ */
+rg_size_t rgh_percentile( rgh_t h, double pct );
+
+
+#endif
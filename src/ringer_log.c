@@ -0,0 +1,636 @@
+/**
+ * @file   ringer_log.c
+ * @author agent <agent@local>
+ * @date   Sun Oct 18 14:45:45 2026
+ *
+ * @brief  Asynchronous logger on top of SPSC Ringer.
+ *
+ */
+
+#include <errno.h>
+#include <sched.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <sys/uio.h>
+#include "ringer_log.h"
+
+
+/* clang-format off */
+
+/** @cond ringer_none */
+#define rgl_true      1
+#define rgl_false     0
+#define rgl_buf_size  65536   /* Format buffer. */
+#define rgl_iov_cnt   256     /* Iovecs per writev(). */
+#define rgl_conv_max  128     /* Maximum formatted conversion. */
+#define rgl_spec_max  32      /* Maximum conversion spec. */
+#define rgl_idle_ns   1000000 /* Sleep when idle. */
+/** @endcond ringer_none */
+
+/* clang-format on */
+
+
+/**
+ * Logging thread.
+ */
+struct rgl_prod_s
+{
+    rgs_t             rs;     /**< Record Ringer. */
+    rgl_rec_s*        rec;    /**< Record storage. */
+    rg_size_t         mask;   /**< Record index mask. */
+    rg_size_t         widx;   /**< Next record. */
+    _Atomic rg_size_t drops;  /**< Dropped records. */
+    atomic_int        exited; /**< Thread has exited. */
+    int               dead;   /**< Drained after exit (Logger thread). */
+    rgl_prod_s*       next;   /**< Next logging thread. */
+};
+
+
+/**
+ * Output batch of Logger thread.
+ */
+struct rgl_out_s
+{
+    int          fd;                    /**< Output file descriptor. */
+    int          cnt;                   /**< Iovec count. */
+    rg_size_t    used;                  /**< Used buffer. */
+    struct iovec iov[ rgl_iov_cnt ];    /**< Output pieces. */
+    char         buf[ rgl_buf_size ];   /**< Formatted conversions. */
+};
+typedef struct rgl_out_s rgl_out_s;
+
+
+static rgl_prod_s* rgl_producer( rgl_t lg );
+static void rgl_text( rgl_rec_s* rec, unsigned strs );
+static void rgl_exit( void* prod );
+static void* rgl_run( void* arg );
+static rg_size_t rgl_drain( rgl_t lg, rgl_out_s* out );
+static void rgl_format( rgl_out_s* out, rgl_rec_s* rec );
+static void rgl_conv( rgl_out_s* out, const char* spec, const char* mod, char conv, rgl_arg_t arg );
+static long long rgl_sint( const char* mod, rgl_arg_t arg );
+static unsigned long long rgl_uint( const char* mod, rgl_arg_t arg );
+static void rgl_piece( rgl_out_s* out, const char* ptr, rg_size_t len );
+static void rgl_flush_out( rgl_out_s* out );
+
+
+
+/* ------------------------------------------------------------
+ * Logger:
+ */
+
+
+rgl_t rgl_new( int fd, rg_size_t size, int policy )
+{
+    rgl_t lg;
+
+    lg = (rgl_t)rg_malloc( sizeof( rgl_s ) );
+
+    if ( pthread_key_create( &lg->key, rgl_exit ) != 0 ) {
+        rg_free( lg );
+        return NULL;
+    }
+
+    lg->fd = fd;
+    lg->size = size;
+    lg->policy = policy;
+    lg->prods = NULL;
+    atomic_init( &lg->stop, 0 );
+    atomic_init( &lg->pass, 0 );
+    atomic_init( &lg->dropped, 0 );
+    pthread_mutex_init( &lg->mutex, NULL );
+
+    if ( pthread_create( &lg->thread, NULL, rgl_run, lg ) != 0 ) {
+        pthread_key_delete( lg->key );
+        pthread_mutex_destroy( &lg->mutex );
+        rg_free( lg );
+        return NULL;
+    }
+
+    return lg;
+}
+
+
+void rgl_destroy( rgl_p lgr )
+{
+    rgl_t       lg = *lgr;
+    rgl_prod_s* prod;
+
+    atomic_store( &lg->stop, 1 );
+    pthread_join( lg->thread, NULL );
+
+    pthread_key_delete( lg->key );
+
+    while ( lg->prods ) {
+        prod = lg->prods;
+        lg->prods = prod->next;
+        rgs_destroy( &prod->rs );
+        rg_free( prod->rec );
+        rg_free( prod );
+    }
+
+    pthread_mutex_destroy( &lg->mutex );
+    rg_free( lg );
+    *lgr = NULL;
+}
+
+
+int rgl_write( rgl_t       lg,
+               const char* fmt,
+               unsigned    strs,
+               rgl_arg_t   a0,
+               rgl_arg_t   a1,
+               rgl_arg_t   a2,
+               rgl_arg_t   a3,
+               rgl_arg_t   a4,
+               rgl_arg_t   a5,
+               rgl_arg_t   a6 )
+{
+    rgl_prod_s* prod;
+    rgl_rec_s*  rec;
+
+    prod = rgl_producer( lg );
+
+    while ( rgs_is_full( prod->rs ) ) {
+        if ( lg->policy == RGL_DROP ) {
+            atomic_store_explicit( &prod->drops,
+                                   atomic_load_explicit( &prod->drops, memory_order_relaxed ) + 1,
+                                   memory_order_relaxed );
+            return rgl_false;
+        }
+        sched_yield();
+    }
+
+    /* Record slot is free, since Logger releases records in order. */
+    rec = &prod->rec[ prod->widx & prod->mask ];
+    rec->fmt = fmt;
+    rec->arg[ 0 ] = a0;
+    rec->arg[ 1 ] = a1;
+    rec->arg[ 2 ] = a2;
+    rec->arg[ 3 ] = a3;
+    rec->arg[ 4 ] = a4;
+    rec->arg[ 5 ] = a5;
+    rec->arg[ 6 ] = a6;
+    if ( strs )
+        rgl_text( rec, strs );
+    prod->widx++;
+
+    rgs_put( prod->rs, rec );
+
+    return rgl_true;
+}
+
+
+void rgl_flush( rgl_t lg )
+{
+    rg_size_t pass;
+
+    /* Wait for one complete pass that started after the call. */
+    pass = atomic_load( &lg->pass );
+    while ( atomic_load( &lg->pass ) < pass + 2 )
+        sched_yield();
+}
+
+
+rg_size_t rgl_drops( rgl_t lg )
+{
+    rg_size_t drops;
+
+    pthread_mutex_lock( &lg->mutex );
+
+    drops = atomic_load( &lg->dropped );
+    for ( rgl_prod_s* prod = lg->prods; prod; prod = prod->next )
+        drops += atomic_load_explicit( &prod->drops, memory_order_relaxed );
+
+    pthread_mutex_unlock( &lg->mutex );
+
+    return drops;
+}
+
+
+
+
+/* ------------------------------------------------------------
+ * Internal functions:
+ */
+
+
+/**
+ * Return logging thread state, create at first call.
+ */
+static rgl_prod_s* rgl_producer( rgl_t lg )
+{
+    rgl_prod_s* prod;
+
+    prod = (rgl_prod_s*)pthread_getspecific( lg->key );
+
+    if ( prod == NULL ) {
+
+        prod = (rgl_prod_s*)rg_malloc( sizeof( rgl_prod_s ) );
+        prod->rs = rgs_new( lg->size );
+        prod->mask = rgs_size( prod->rs ) - 1;
+        prod->rec = (rgl_rec_s*)rg_malloc( rgs_size( prod->rs ) * sizeof( rgl_rec_s ) );
+        prod->widx = 0;
+        atomic_init( &prod->drops, 0 );
+        atomic_init( &prod->exited, 0 );
+        prod->dead = 0;
+
+        pthread_mutex_lock( &lg->mutex );
+        prod->next = lg->prods;
+        lg->prods = prod;
+        pthread_mutex_unlock( &lg->mutex );
+
+        pthread_setspecific( lg->key, prod );
+    }
+
+    return prod;
+}
+
+
+/**
+ * Copy string arguments to record text.
+ *
+ * Strings are truncated when text runs out.
+ */
+static void rgl_text( rgl_rec_s* rec, unsigned strs )
+{
+    rg_size_t used = 0;
+    rg_size_t len;
+
+    for ( int i = 0; i < RGL_MAX_ARGS; i++ ) {
+
+        if ( !( strs & ( 1u << i ) ) || rec->arg[ i ].p == NULL )
+            continue;
+
+        len = strlen( rec->arg[ i ].p );
+        if ( len > RGL_TEXT_MAX - 1 - used )
+            len = RGL_TEXT_MAX - 1 - used;
+
+        memcpy( &rec->text[ used ], rec->arg[ i ].p, len );
+        rec->text[ used + len ] = 0;
+        rec->arg[ i ].p = &rec->text[ used ];
+
+        /* Strings after full text share the last terminator. */
+        used += len;
+        if ( used < RGL_TEXT_MAX - 1 )
+            used++;
+    }
+}
+
+
+/**
+ * Mark logging thread exited, Logger thread releases it.
+ */
+static void rgl_exit( void* prod )
+{
+    atomic_store( &( (rgl_prod_s*)prod )->exited, 1 );
+}
+
+
+/**
+ * Logger thread.
+ *
+ * After stop request, records are drained until none are left.
+ */
+static void* rgl_run( void* arg )
+{
+    rgl_t      lg = arg;
+    rgl_out_s* out;
+    rg_size_t  cnt;
+    int        stop;
+
+    struct timespec idle = { 0, rgl_idle_ns };
+
+    out = (rgl_out_s*)rg_malloc( sizeof( rgl_out_s ) );
+    out->fd = lg->fd;
+    out->cnt = 0;
+    out->used = 0;
+
+    for ( ;; ) {
+
+        stop = atomic_load( &lg->stop );
+        cnt = rgl_drain( lg, out );
+        atomic_fetch_add( &lg->pass, 1 );
+
+        if ( cnt == 0 ) {
+            if ( stop )
+                break;
+            nanosleep( &idle, NULL );
+        }
+    }
+
+    rg_free( out );
+
+    return NULL;
+}
+
+
+/**
+ * Format and write records from all logging threads.
+ *
+ * Lock is held only for the list head and unlinking, since logging
+ * threads are only prepended and only Logger thread unlinks. Records
+ * are taken up to the count at visit, so one busy thread can't starve
+ * the others.
+ *
+ * @return Number of records.
+ */
+static rg_size_t rgl_drain( rgl_t lg, rgl_out_s* out )
+{
+    rgl_prod_s** link;
+    rgl_prod_s*  prod;
+    rgl_prod_s*  dead;
+    rg_size_t    cnt;
+    rg_size_t    n;
+    int          exited;
+
+    cnt = 0;
+    dead = NULL;
+
+    pthread_mutex_lock( &lg->mutex );
+    prod = lg->prods;
+    pthread_mutex_unlock( &lg->mutex );
+
+    for ( ; prod; prod = prod->next ) {
+
+        /* Exit flag is read before count, so none are missed. */
+        exited = atomic_load( &prod->exited );
+
+        for ( n = rgs_count( prod->rs ); n > 0; n-- ) {
+            rgl_format( out, rgs_peek( prod->rs ) );
+            rgs_get( prod->rs );
+            cnt++;
+        }
+
+        if ( exited ) {
+            prod->dead = rgl_true;
+            dead = prod;
+        }
+    }
+
+    rgl_flush_out( out );
+
+    if ( dead ) {
+
+        dead = NULL;
+
+        pthread_mutex_lock( &lg->mutex );
+
+        link = &lg->prods;
+        while ( ( prod = *link ) ) {
+            if ( prod->dead ) {
+                *link = prod->next;
+                atomic_fetch_add( &lg->dropped, atomic_load( &prod->drops ) );
+                prod->next = dead;
+                dead = prod;
+            } else {
+                link = &prod->next;
+            }
+        }
+
+        pthread_mutex_unlock( &lg->mutex );
+
+        while ( ( prod = dead ) ) {
+            dead = prod->next;
+            rgs_destroy( &prod->rs );
+            rg_free( prod->rec );
+            rg_free( prod );
+        }
+    }
+
+    return cnt;
+}
+
+
+/**
+ * Format record to output batch.
+ *
+ * Literal text is referenced from format string, and conversions are
+ * formatted to output buffer.
+ */
+static void rgl_format( rgl_out_s* out, rgl_rec_s* rec )
+{
+    const char* fmt = rec->fmt;
+    const char* lit;
+    char        spec[ rgl_spec_max ];
+    char        mod[ rgl_spec_max ];
+    int         len;
+    int         arg;
+    int         j;
+    int         k;
+
+    lit = fmt;
+    arg = 0;
+
+    while ( *fmt ) {
+
+        if ( *fmt != '%' ) {
+            fmt++;
+            continue;
+        }
+
+        rgl_piece( out, lit, fmt - lit );
+
+        if ( fmt[ 1 ] == '%' ) {
+            lit = fmt + 1;
+            fmt += 2;
+            continue;
+        }
+
+        /* Flags, width, precision, and length modifiers. */
+        len = 1;
+        while ( fmt[ len ] && strchr( "-+ #0123456789.hlLqjzt", fmt[ len ] ) )
+            len++;
+
+        if ( fmt[ len ] && len < rgl_spec_max - 3 && arg < RGL_MAX_ARGS
+             && strchr( "diouxXcsfFeEgGaAp", fmt[ len ] ) ) {
+
+            /* Spec and length modifiers separately. */
+            j = 0;
+            k = 0;
+            spec[ j++ ] = '%';
+            for ( int i = 1; i < len; i++ ) {
+                if ( strchr( "hlLqjzt", fmt[ i ] ) )
+                    mod[ k++ ] = fmt[ i ];
+                else
+                    spec[ j++ ] = fmt[ i ];
+            }
+            spec[ j ] = 0;
+            mod[ k ] = 0;
+
+            rgl_conv( out, spec, mod, fmt[ len ], rec->arg[ arg++ ] );
+            fmt += len + 1;
+            lit = fmt;
+
+        } else {
+
+            /* Unsupported, output as is. */
+            lit = fmt;
+            fmt += ( fmt[ len ] ? len + 1 : len );
+        }
+    }
+
+    rgl_piece( out, lit, fmt - lit );
+}
+
+
+/**
+ * Format one conversion to output buffer.
+ *
+ * Integers are truncated to the width of length modifier, as printf
+ * does, and then formatted as long long.
+ */
+static void rgl_conv( rgl_out_s* out, const char* spec, const char* mod, char conv, rgl_arg_t arg )
+{
+    char  fmt[ rgl_spec_max + 4 ];
+    char* buf;
+    int   len;
+
+    /* Room for conversion and its piece. */
+    if ( out->cnt >= rgl_iov_cnt || out->used + rgl_conv_max > rgl_buf_size )
+        rgl_flush_out( out );
+    buf = &out->buf[ out->used ];
+
+    if ( strchr( "di", conv ) ) {
+        snprintf( fmt, sizeof( fmt ), "%sll%c", spec, conv );
+        len = snprintf( buf, rgl_conv_max, fmt, rgl_sint( mod, arg ) );
+    } else if ( strchr( "ouxX", conv ) ) {
+        snprintf( fmt, sizeof( fmt ), "%sll%c", spec, conv );
+        len = snprintf( buf, rgl_conv_max, fmt, rgl_uint( mod, arg ) );
+    } else if ( conv == 'c' ) {
+        snprintf( fmt, sizeof( fmt ), "%s%c", spec, conv );
+        len = snprintf( buf, rgl_conv_max, fmt, (int)arg.u );
+    } else if ( conv == 's' ) {
+        snprintf( fmt, sizeof( fmt ), "%s%c", spec, conv );
+        len = snprintf( buf, rgl_conv_max, fmt, arg.p ? (const char*)arg.p : "(null)" );
+    } else if ( conv == 'p' ) {
+        snprintf( fmt, sizeof( fmt ), "%s%c", spec, conv );
+        len = snprintf( buf, rgl_conv_max, fmt, arg.p );
+    } else {
+        snprintf( fmt, sizeof( fmt ), "%s%c", spec, conv );
+        len = snprintf( buf, rgl_conv_max, fmt, arg.d );
+    }
+
+    if ( len < 0 )
+        len = 0;
+    if ( len >= rgl_conv_max )
+        len = rgl_conv_max - 1;
+
+    rgl_piece( out, buf, len );
+    out->used += len;
+}
+
+
+/**
+ * Return signed integer argument with width of length modifier.
+ */
+static long long rgl_sint( const char* mod, rgl_arg_t arg )
+{
+    if ( !strcmp( mod, "" ) )
+        return (int)arg.u;
+    else if ( !strcmp( mod, "hh" ) )
+        return (signed char)arg.u;
+    else if ( !strcmp( mod, "h" ) )
+        return (short)arg.u;
+    else if ( !strcmp( mod, "l" ) )
+        return (long)arg.u;
+    else if ( !strcmp( mod, "j" ) )
+        return (intmax_t)arg.u;
+    else if ( !strcmp( mod, "z" ) )
+        return (ssize_t)arg.u;
+    else if ( !strcmp( mod, "t" ) )
+        return (ptrdiff_t)arg.u;
+    else
+        return (long long)arg.u;
+}
+
+
+/**
+ * Return unsigned integer argument with width of length modifier.
+ */
+static unsigned long long rgl_uint( const char* mod, rgl_arg_t arg )
+{
+    if ( !strcmp( mod, "" ) )
+        return (unsigned int)arg.u;
+    else if ( !strcmp( mod, "hh" ) )
+        return (unsigned char)arg.u;
+    else if ( !strcmp( mod, "h" ) )
+        return (unsigned short)arg.u;
+    else if ( !strcmp( mod, "l" ) )
+        return (unsigned long)arg.u;
+    else if ( !strcmp( mod, "j" ) )
+        return (uintmax_t)arg.u;
+    else if ( !strcmp( mod, "z" ) || !strcmp( mod, "t" ) )
+        return (size_t)arg.u;
+    else
+        return (unsigned long long)arg.u;
+}
+
+
+/**
+ * Add piece to output batch, extend previous if contiguous.
+ *
+ * Batch is written when iovecs run out. Conversions reserve their
+ * iovec beforehand, since the write releases the buffer.
+ */
+static void rgl_piece( rgl_out_s* out, const char* ptr, rg_size_t len )
+{
+    struct iovec* last;
+
+    if ( len == 0 )
+        return;
+
+    last = out->cnt ? &out->iov[ out->cnt - 1 ] : NULL;
+
+    if ( last && (const char*)last->iov_base + last->iov_len == ptr ) {
+        last->iov_len += len;
+    } else {
+        if ( out->cnt >= rgl_iov_cnt )
+            rgl_flush_out( out );
+        out->iov[ out->cnt ].iov_base = (void*)ptr;
+        out->iov[ out->cnt ].iov_len = len;
+        out->cnt++;
+    }
+}
+
+
+/**
+ * Write output batch with writev().
+ *
+ * Partial writes are continued. Output is discarded on error.
+ */
+static void rgl_flush_out( rgl_out_s* out )
+{
+    struct iovec* iov = out->iov;
+    int           cnt = out->cnt;
+    ssize_t       ret;
+
+    while ( cnt > 0 ) {
+
+        ret = writev( out->fd, iov, cnt );
+
+        if ( ret < 0 ) {
+            if ( errno == EINTR || errno == EAGAIN ) {
+                sched_yield();
+                continue;
+            }
+            break;
+        }
+
+        while ( cnt > 0 && (size_t)ret >= iov->iov_len ) {
+            ret -= iov->iov_len;
+            iov++;
+            cnt--;
+        }
+
+        if ( cnt > 0 ) {
+            iov->iov_base = (char*)iov->iov_base + ret;
+            iov->iov_len -= ret;
+        }
+    }
+
+    out->cnt = 0;
+    out->used = 0;
+}
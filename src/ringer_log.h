@@ -0,0 +1,263 @@
+#ifndef RINGER_LOG_H
+#define RINGER_LOG_H
+
+/**
+ * @file   ringer_log.h
+ * @author agent <agent@local>
+ * @date   Sun Oct 18 14:45:45 2026
+ *
+ * @brief  Asynchronous logger on top of SPSC Ringer.
+ *
+ * Logging thread stores a fixed size binary record (format string
+ * pointer and up to seven arguments) to its own SPSC Ringer. Logger
+ * thread formats the records, and writes them to file descriptor in
+ * batches with writev(). Hence logging is a few stores (and string
+ * copies) for the logging thread.
+ *
+ *     rgl_t lg = rgl_new( STDERR_FILENO, 1024, RGL_DROP );
+ *     rgl_log( lg, "request %d took %.3f ms\n", id, ms );
+ *
+ * Format string is referenced after the call, hence it must be a
+ * string literal, which rgl_log() enforces. String arguments (char*)
+ * are copied to the record, up to RGL_TEXT_MAX - 1 characters in total,
+ * and longer strings are truncated. Other pointer arguments must be
+ * cast to void*, and they are not dereferenced by "%p". Supported
+ * conversions are the printf conversions, without '*' width or
+ * precision. Formatted conversion is limited to 127 characters.
+ *
+ */
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include "ringer_spsc.h"
+
+
+/** Drop record when thread's Ringer is full. */
+#define RGL_DROP 0
+
+/** Wait for space when thread's Ringer is full. */
+#define RGL_BLOCK 1
+
+/** Maximum argument count. */
+#define RGL_MAX_ARGS 7
+
+/** String argument storage per record. */
+#define RGL_TEXT_MAX 64
+
+
+/**
+ * Log argument.
+ */
+union rgl_arg_u
+{
+    uint64_t    u; /**< Integer. */
+    double      d; /**< Floating point. */
+    const void* p; /**< Pointer or string. */
+};
+typedef union rgl_arg_u rgl_arg_t; /**< Log argument type. */
+
+
+/**
+ * Log record (two cache lines).
+ */
+struct rgl_rec_s
+{
+    const char* fmt;                   /**< Format string. */
+    rgl_arg_t   arg[ RGL_MAX_ARGS ];   /**< Arguments. */
+    char        text[ RGL_TEXT_MAX ];  /**< Copied string arguments. */
+};
+typedef struct rgl_rec_s rgl_rec_s; /**< Log record struct. */
+
+
+typedef struct rgl_prod_s rgl_prod_s; /**< Logging thread struct (opaque). */
+
+
+/**
+ * Logger struct.
+ */
+struct rgl_struct_s
+{
+    int               fd;      /**< Output file descriptor. */
+    rg_size_t         size;    /**< Ringer size per thread. */
+    int               policy;  /**< Overflow policy. */
+    pthread_key_t     key;     /**< Logging thread key. */
+    pthread_mutex_t   mutex;   /**< Logging thread list lock. */
+    rgl_prod_s*       prods;   /**< Logging threads. */
+    pthread_t         thread;  /**< Logger thread. */
+    atomic_int        stop;    /**< Stop request. */
+    _Atomic rg_size_t pass;    /**< Completed drain passes. */
+    _Atomic rg_size_t dropped; /**< Drops of exited threads. */
+};
+typedef struct rgl_struct_s rgl_s; /**< Logger struct. */
+typedef rgl_s*              rgl_t; /**< Logger pointer. */
+typedef rgl_t*              rgl_p; /**< Logger pointer reference. */
+
+
+
+/* ------------------------------------------------------------
+ * Log arguments:
+ */
+
+/** @cond ringer_none */
+
+static inline rgl_arg_t rgl_arg_u( uint64_t u )
+{
+    rgl_arg_t a;
+    a.u = u;
+    return a;
+}
+
+static inline rgl_arg_t rgl_arg_d( double d )
+{
+    rgl_arg_t a;
+    a.d = d;
+    return a;
+}
+
+static inline rgl_arg_t rgl_arg_p( const void* p )
+{
+    rgl_arg_t a;
+    a.p = p;
+    return a;
+}
+
+#define rgl_arg( x )                  \
+    _Generic( ( x ),                  \
+              float: rgl_arg_d,       \
+              double: rgl_arg_d,      \
+              char*: rgl_arg_p,       \
+              const char*: rgl_arg_p, \
+              void*: rgl_arg_p,       \
+              const void*: rgl_arg_p, \
+              default: rgl_arg_u )( x )
+
+#define rgl_z rgl_arg_u( 0 )
+
+#define rgl_str( x, i ) _Generic( ( x ), char*: 1u << ( i ), const char*: 1u << ( i ), default: 0u )
+
+#define RGL_NTH( _1, _2, _3, _4, _5, _6, _7, _8, N, ... ) N
+#define RGL_CNT( ... ) RGL_NTH( __VA_ARGS__, 7, 6, 5, 4, 3, 2, 1, 0, _ )
+#define RGL_CAT( a, b ) a##b
+#define RGL_XCAT( a, b ) RGL_CAT( a, b )
+#define RGL_FMT( f, ... ) f
+
+#define RGL_ARGS0( f ) rgl_z, rgl_z, rgl_z, rgl_z, rgl_z, rgl_z, rgl_z
+#define RGL_ARGS1( f, a ) rgl_arg( a ), rgl_z, rgl_z, rgl_z, rgl_z, rgl_z, rgl_z
+#define RGL_ARGS2( f, a, b ) rgl_arg( a ), rgl_arg( b ), rgl_z, rgl_z, rgl_z, rgl_z, rgl_z
+#define RGL_ARGS3( f, a, b, c ) rgl_arg( a ), rgl_arg( b ), rgl_arg( c ), rgl_z, rgl_z, rgl_z, rgl_z
+#define RGL_ARGS4( f, a, b, c, d )                                                                 \
+    rgl_arg( a ), rgl_arg( b ), rgl_arg( c ), rgl_arg( d ), rgl_z, rgl_z, rgl_z
+#define RGL_ARGS5( f, a, b, c, d, e )                                                              \
+    rgl_arg( a ), rgl_arg( b ), rgl_arg( c ), rgl_arg( d ), rgl_arg( e ), rgl_z, rgl_z
+#define RGL_ARGS6( f, a, b, c, d, e, g )                                                           \
+    rgl_arg( a ), rgl_arg( b ), rgl_arg( c ), rgl_arg( d ), rgl_arg( e ), rgl_arg( g ), rgl_z
+#define RGL_ARGS7( f, a, b, c, d, e, g, h )                                                        \
+    rgl_arg( a ), rgl_arg( b ), rgl_arg( c ), rgl_arg( d ), rgl_arg( e ), rgl_arg( g ), rgl_arg( h )
+
+#define RGL_STRS0( f ) 0u
+#define RGL_STRS1( f, a ) rgl_str( a, 0 )
+#define RGL_STRS2( f, a, b ) rgl_str( a, 0 ) | rgl_str( b, 1 )
+#define RGL_STRS3( f, a, b, c ) rgl_str( a, 0 ) | rgl_str( b, 1 ) | rgl_str( c, 2 )
+#define RGL_STRS4( f, a, b, c, d ) RGL_STRS3( f, a, b, c ) | rgl_str( d, 3 )
+#define RGL_STRS5( f, a, b, c, d, e ) RGL_STRS4( f, a, b, c, d ) | rgl_str( e, 4 )
+#define RGL_STRS6( f, a, b, c, d, e, g ) RGL_STRS5( f, a, b, c, d, e ) | rgl_str( g, 5 )
+#define RGL_STRS7( f, a, b, c, d, e, g, h ) RGL_STRS6( f, a, b, c, d, e, g ) | rgl_str( h, 6 )
+
+/** @endcond ringer_none */
+
+
+/**
+ * Log message.
+ *
+ * Format string must be a string literal. String arguments are
+ * copied.
+ *
+ * @param lg  Logger.
+ * @param ... Format string and up to seven arguments.
+ */
+#define rgl_log( lg, ... )                                                                         \
+    rgl_write( ( lg ),                                                                             \
+               "" RGL_FMT( __VA_ARGS__, _ ) "",                                                    \
+               RGL_XCAT( RGL_STRS, RGL_CNT( __VA_ARGS__ ) )( __VA_ARGS__ ),                        \
+               RGL_XCAT( RGL_ARGS, RGL_CNT( __VA_ARGS__ ) )( __VA_ARGS__ ) )
+
+
+
+/* ------------------------------------------------------------
+ * Logger:
+ */
+
+
+/**
+ * Create Logger and start Logger thread.
+ *
+ * @param fd     Output file descriptor.
+ * @param size   Ringer size (records) per logging thread.
+ * @param policy RGL_DROP or RGL_BLOCK.
+ *
+ * @return Logger (or NULL if thread or thread key could not be created).
+ */
+rgl_t rgl_new( int fd, rg_size_t size, int policy );
+
+
+/**
+ * Destroy Logger.
+ *
+ * All logged records are written before Logger thread is stopped.
+ * Logging threads must have stopped logging.
+ *
+ * @param lgr Logger reference.
+ */
+void rgl_destroy( rgl_p lgr );
+
+
+/**
+ * Write log record.
+ *
+ * Use rgl_log() macro, which packs the arguments.
+ *
+ * @param lg   Logger.
+ * @param fmt  Format string.
+ * @param strs Bit mask of string arguments (copied).
+ * @param a0   Argument.
+ * @param a1   Argument.
+ * @param a2   Argument.
+ * @param a3   Argument.
+ * @param a4   Argument.
+ * @param a5   Argument.
+ * @param a6   Argument.
+ *
+ * @return 1 if record was stored (0 if dropped).
+ */
+int rgl_write( rgl_t       lg,
+               const char* fmt,
+               unsigned    strs,
+               rgl_arg_t   a0,
+               rgl_arg_t   a1,
+               rgl_arg_t   a2,
+               rgl_arg_t   a3,
+               rgl_arg_t   a4,
+               rgl_arg_t   a5,
+               rgl_arg_t   a6 );
+
+
+/**
+ * Wait until records logged before the call are written.
+ *
+ * @param lg Logger.
+ */
+void rgl_flush( rgl_t lg );
+
+
+/**
+ * Return count of dropped records.
+ *
+ * @param lg Logger.
+ *
+ * @return Count.
+ */
+rg_size_t rgl_drops( rgl_t lg );
+
+
+#endif
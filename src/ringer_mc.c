@@ -0,0 +1,214 @@
+/**
+ * @file   ringer_mc.c
+ * @author agent <agent@local>
+ * @date   Sun Oct 18 14:40:47 2026
+ *
+ * @brief  Multicast Ringer with consumer cursors.
+ *
+ */
+
+#include "ringer_mc.h"
+
+
+/* clang-format off */
+
+/** @cond ringer_none */
+#define rgm_true  1
+#define rgm_false 0
+#define rgm_struct_size(size) ( sizeof(rgm_s) + size*sizeof(void*) )
+#define rgm_load( var )         atomic_load_explicit( &( var ), memory_order_acquire )
+#define rgm_store( var, val )   atomic_store_explicit( &( var ), ( val ), memory_order_release )
+/** @endcond ringer_none */
+
+/* clang-format on */
+
+
+static rg_size_t rgm_slowest( rgm_t m );
+static rg_size_t rgm_limit( rgm_t m, rgm_cons_s* cons );
+
+
+
+/* ------------------------------------------------------------
+ * Multicast Ringer:
+ */
+
+
+rgm_t rgm_new( rg_size_t size )
+{
+    rgm_t     m;
+    rg_size_t pow;
+
+    pow = RG_MIN_SIZE;
+    while ( pow < size )
+        pow <<= 1;
+
+    m = (rgm_t)rg_malloc( rgm_struct_size( pow ) );
+
+    atomic_init( &m->widx, 0 );
+    m->gate = 0;
+    m->cnt = 0;
+    m->cons = (rgm_cons_s*)rg_malloc( RGM_MAX_CONSUMERS * sizeof( rgm_cons_s ) );
+    m->size = pow;
+    m->mask = pow - 1;
+
+    return m;
+}
+
+
+void rgm_destroy( rgm_p mr )
+{
+    rg_free( ( *mr )->cons );
+    rg_free( *mr );
+    *mr = NULL;
+}
+
+
+int rgm_add( rgm_t m, uint64_t deps )
+{
+    rgm_cons_s* cons;
+
+    if ( m->cnt >= RGM_MAX_CONSUMERS )
+        return -1;
+
+    /* Only existing consumers can be dependencies. */
+    if ( ( deps >> m->cnt ) != 0 )
+        return -1;
+
+    cons = &m->cons[ m->cnt ];
+    cons->limit = atomic_load( &m->widx );
+    atomic_init( &cons->cursor, cons->limit );
+    cons->deps = deps;
+
+    return m->cnt++;
+}
+
+
+int rgm_put( rgm_t m, void* item )
+{
+    rg_size_t widx;
+
+    widx = atomic_load_explicit( &m->widx, memory_order_relaxed );
+
+    if ( widx - m->gate >= m->size ) {
+        m->gate = rgm_slowest( m );
+        if ( widx - m->gate >= m->size )
+            return rgm_false;
+    }
+
+    m->data[ widx & m->mask ] = item;
+    rgm_store( m->widx, widx + 1 );
+
+    return rgm_true;
+}
+
+
+rg_size_t rgm_avail( rgm_t m, int id )
+{
+    rgm_cons_s* cons = &m->cons[ id ];
+    rg_size_t   cursor;
+
+    cursor = atomic_load_explicit( &cons->cursor, memory_order_relaxed );
+
+    if ( cons->limit == cursor )
+        cons->limit = rgm_limit( m, cons );
+
+    return cons->limit - cursor;
+}
+
+
+void* rgm_peek( rgm_t m, int id, rg_size_t pos )
+{
+    rg_size_t cursor;
+
+    cursor = atomic_load_explicit( &m->cons[ id ].cursor, memory_order_relaxed );
+
+    return m->data[ ( cursor + pos ) & m->mask ];
+}
+
+
+void rgm_release( rgm_t m, int id, rg_size_t n )
+{
+    rgm_cons_s* cons = &m->cons[ id ];
+    rg_size_t   cursor;
+
+    cursor = atomic_load_explicit( &cons->cursor, memory_order_relaxed );
+    rgm_store( cons->cursor, cursor + n );
+}
+
+
+void* rgm_get( rgm_t m, int id )
+{
+    void* item;
+
+    if ( rgm_avail( m, id ) == 0 )
+        return NULL;
+
+    item = rgm_peek( m, id, 0 );
+    rgm_release( m, id, 1 );
+
+    return item;
+}
+
+
+rg_size_t rgm_size( rgm_t m )
+{
+    return m->size;
+}
+
+
+
+
+/* ------------------------------------------------------------
+ * Internal functions:
+ */
+
+
+/**
+ * Return cursor of slowest consumer.
+ *
+ * Without consumers producer is not gated.
+ */
+static rg_size_t rgm_slowest( rgm_t m )
+{
+    rg_size_t min;
+    rg_size_t cursor;
+
+    min = atomic_load_explicit( &m->widx, memory_order_relaxed );
+
+    for ( int i = 0; i < m->cnt; i++ ) {
+        cursor = rgm_load( m->cons[ i ].cursor );
+        if ( cursor < min )
+            min = cursor;
+    }
+
+    return min;
+}
+
+
+/**
+ * Return limit of items visible to consumer.
+ *
+ * Limit is the published count, or the slowest cursor of
+ * dependencies.
+ */
+static rg_size_t rgm_limit( rgm_t m, rgm_cons_s* cons )
+{
+    rg_size_t min;
+    rg_size_t cursor;
+    uint64_t  deps;
+    int       id;
+
+    if ( cons->deps == 0 )
+        return rgm_load( m->widx );
+
+    min = (rg_size_t)-1;
+
+    for ( deps = cons->deps; deps; deps &= deps - 1 ) {
+        id = __builtin_ctzll( deps );
+        cursor = rgm_load( m->cons[ id ].cursor );
+        if ( cursor < min )
+            min = cursor;
+    }
+
+    return min;
+}
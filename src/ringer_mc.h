@@ -0,0 +1,184 @@
+#ifndef RINGER_MC_H
+#define RINGER_MC_H
+
+/**
+ * @file   ringer_mc.h
+ * @author agent <agent@local>
+ * @date   Sun Oct 18 14:40:47 2026
+ *
+ * @brief  Multicast Ringer with consumer cursors.
+ *
+ * Multicast Ringer delivers every item to all consumers. Producer
+ * writes the item once, and each consumer has its own read cursor to
+ * the shared storage. Producer is gated by the slowest consumer,
+ * i.e. an item is overwritten only after all consumers have released
+ * it.
+ *
+ * Consumer may depend on other consumers. Consumer sees an item only
+ * after all its dependencies have released the item, hence consumers
+ * form a processing pipeline over the same items.
+ *
+ * There is one producer thread, and each consumer is used by one
+ * thread. Consumers are added before items are put.
+ *
+ */
+
+#include <stdatomic.h>
+#include "ringer.h"
+
+
+/** Cache line size for separating shared data. */
+#define RGM_CACHE_LINE 64
+
+/** Maximum consumer count. */
+#define RGM_MAX_CONSUMERS 64
+
+
+/**
+ * Consumer.
+ */
+struct rgm_cons_s
+{
+    _Atomic rg_size_t cursor; /**< Released item count. */
+    uint64_t          deps;   /**< Dependency mask (consumer ids). */
+    rg_size_t         limit;  /**< Cached limit of visible items. */
+    /** @cond ringer_none */
+    char pad[ RGM_CACHE_LINE - 3 * sizeof( rg_size_t ) ];
+    /** @endcond ringer_none */
+};
+typedef struct rgm_cons_s rgm_cons_s; /**< Consumer struct. */
+
+
+/**
+ * Multicast Ringer struct.
+ */
+struct rgm_struct_s
+{
+    _Atomic rg_size_t widx; /**< Published item count. */
+    rg_size_t         gate; /**< Cached slowest consumer cursor. */
+    /** @cond ringer_none */
+    char pad[ RGM_CACHE_LINE - 2 * sizeof( rg_size_t ) ];
+    /** @endcond ringer_none */
+    int         cnt;       /**< Consumer count. */
+    rgm_cons_s* cons;      /**< Consumers. */
+    rg_size_t   size;      /**< Size (power of two). */
+    rg_size_t   mask;      /**< Index mask. */
+    void*       data[ 0 ]; /**< Pointer array. */
+};
+typedef struct rgm_struct_s rgm_s; /**< Multicast Ringer struct. */
+typedef rgm_s*              rgm_t; /**< Multicast Ringer pointer. */
+typedef rgm_t*              rgm_p; /**< Multicast Ringer pointer reference. */
+
+
+
+/* ------------------------------------------------------------
+ * Multicast Ringer:
+ */
+
+
+/**
+ * Create Multicast Ringer with size.
+ *
+ * Size is rounded up to power of two.
+ *
+ * @param size Size.
+ *
+ * @return Multicast Ringer.
+ */
+rgm_t rgm_new( rg_size_t size );
+
+
+/**
+ * Destroy Multicast Ringer.
+ *
+ * @param mr Multicast Ringer reference.
+ */
+void rgm_destroy( rgm_p mr );
+
+
+/**
+ * Add consumer to Multicast Ringer.
+ *
+ * Dependency mask has bit (1 << id) set for each consumer that must
+ * release an item before the new consumer sees it. Dependencies must
+ * be added before the consumer.
+ *
+ * @param m    Multicast Ringer.
+ * @param deps Dependency mask (0 for none).
+ *
+ * @return Consumer id (or -1 if not added).
+ */
+int rgm_add( rgm_t m, uint64_t deps );
+
+
+/**
+ * Put item to Multicast Ringer.
+ *
+ * @param m    Multicast Ringer.
+ * @param item Item.
+ *
+ * @return 1 on success (0 if slowest consumer has not released space).
+ */
+int rgm_put( rgm_t m, void* item );
+
+
+/**
+ * Return count of items visible to consumer.
+ *
+ * @param m  Multicast Ringer.
+ * @param id Consumer id.
+ *
+ * @return Count.
+ */
+rg_size_t rgm_avail( rgm_t m, int id );
+
+
+/**
+ * Peek item from consumer cursor.
+ *
+ * @param m   Multicast Ringer.
+ * @param id  Consumer id.
+ * @param pos Offset from cursor (below rgm_avail()).
+ *
+ * @return Item.
+ */
+void* rgm_peek( rgm_t m, int id, rg_size_t pos );
+
+
+/**
+ * Release items from consumer.
+ *
+ * Released items become visible to dependent consumers, and space is
+ * available to producer when all consumers have released items.
+ *
+ * @param m  Multicast Ringer.
+ * @param id Consumer id.
+ * @param n  Item count (at most rgm_avail()).
+ */
+void rgm_release( rgm_t m, int id, rg_size_t n );
+
+
+/**
+ * Get item for consumer.
+ *
+ * Same as peek and release of one item.
+ *
+ * @param m  Multicast Ringer.
+ * @param id Consumer id.
+ *
+ * @return Item (or NULL if none visible).
+ */
+void* rgm_get( rgm_t m, int id );
+
+
+/**
+ * Return Multicast Ringer storage size.
+ *
+ * @param m Multicast Ringer.
+ *
+ * @return Size.
+ */
+rg_size_t rgm_size( rgm_t m );
+
+
+#endif
@@ -0,0 +1,379 @@
+/**
+ * @file   ringer_pipe.c
+ * @author agent <agent@local>
+ * @date   Sun Oct 18 14:49:04 2026
+ *
+ * @brief  Multi-stage pipeline over SPSC Ringers.
+ *
+ */
+
+#define _GNU_SOURCE
+#include <sched.h>
+#include <time.h>
+#include "ringer_pipe.h"
+
+
+/* clang-format off */
+
+/** @cond ringer_none */
+#define rgpl_true      1
+#define rgpl_false     0
+#define rgpl_created   0
+#define rgpl_running   1
+#define rgpl_stopped   2
+#define rgpl_spin_max  1000    /* Yields before sleep when idle. */
+#define rgpl_idle_ns   50000   /* Sleep when idle. */
+
+#define rgpl_load( var )        atomic_load_explicit( &( var ), memory_order_relaxed )
+#define rgpl_set( var, val )    atomic_store_explicit( &( var ), ( val ), memory_order_relaxed )
+#define rgpl_inc( var, val )    rgpl_set( var, rgpl_load( var ) + ( val ) )
+/** @endcond ringer_none */
+
+/* clang-format on */
+
+
+/**
+ * Stage.
+ *
+ * Counters are written only by the stage thread.
+ */
+struct rgpl_stage_s
+{
+    rgpl_t            pl;       /**< Pipeline. */
+    rgs_t             in;       /**< Input Ringer. */
+    rgs_t             out;      /**< Output Ringer (next stage input). */
+    atomic_int*       out_done; /**< Output closed flag. */
+    rgpl_stage_fn_t   fn;       /**< Stage function. */
+    void*             ctx;      /**< Stage context. */
+    int               cpu;      /**< Pinned CPU. */
+    pthread_t         thread;   /**< Stage thread. */
+    void**            buf;      /**< Batch buffer. */
+    /** @cond ringer_none */
+    char pad0[ RG_CACHE_LINE ];
+    /** @endcond ringer_none */
+    atomic_int        done;     /**< Input closed (no more items). */
+    atomic_int        discard;  /**< Output discarded (next stage not started). */
+    _Atomic rg_size_t items;    /**< Processed items. */
+    _Atomic rg_size_t batches;  /**< Processed batches. */
+    _Atomic rg_size_t stalls;   /**< Output full waits. */
+    _Atomic rg_size_t occ_sum;  /**< Input occupancy sum. */
+    _Atomic rg_size_t occ_max;  /**< Input occupancy maximum. */
+};
+
+
+static void* rgpl_run( void* arg );
+static int rgpl_spawn( rgpl_stage_s* st );
+static void rgpl_idle( int* spin );
+static rg_size_t rgpl_now( void );
+
+
+
+/* ------------------------------------------------------------
+ * Pipeline:
+ */
+
+
+rgpl_t rgpl_new( rg_size_t size, rg_size_t batch )
+{
+    rgpl_t pl;
+
+    pl = (rgpl_t)rg_malloc( sizeof( rgpl_s ) );
+
+    pl->size = size;
+    pl->batch = batch;
+    pl->cnt = 0;
+    pl->state = rgpl_created;
+    pl->start = 0;
+    pl->end = 0;
+
+    return pl;
+}
+
+
+void rgpl_destroy( rgpl_p plr )
+{
+    rgpl_t        pl = *plr;
+    rgpl_stage_s* st;
+
+    if ( pl->state == rgpl_running )
+        rgpl_stop( pl );
+
+    for ( int i = 0; i < pl->cnt; i++ ) {
+        st = pl->stage[ i ];
+        rgs_destroy( &st->in );
+        rg_free( st->buf );
+        rg_free( st );
+    }
+
+    rg_free( pl );
+    *plr = NULL;
+}
+
+
+int rgpl_add( rgpl_t pl, rgpl_stage_fn_t fn, void* ctx, int cpu )
+{
+    rgpl_stage_s* st;
+    rgpl_stage_s* prev;
+
+    if ( pl->state != rgpl_created || pl->cnt >= RGPL_MAX_STAGES )
+        return -1;
+
+    st = (rgpl_stage_s*)rg_malloc( sizeof( rgpl_stage_s ) );
+
+    st->pl = pl;
+    st->in = rgs_new( pl->size );
+    st->out = NULL;
+    st->out_done = NULL;
+    st->fn = fn;
+    st->ctx = ctx;
+    st->cpu = cpu;
+
+    /* Batch is limited by Ringer size. */
+    if ( pl->batch == 0 || pl->batch > rgs_size( st->in ) )
+        pl->batch = rgs_size( st->in );
+    st->buf = (void**)rg_malloc( rgs_size( st->in ) * sizeof( void* ) );
+
+    atomic_init( &st->done, 0 );
+    atomic_init( &st->discard, 0 );
+    atomic_init( &st->items, 0 );
+    atomic_init( &st->batches, 0 );
+    atomic_init( &st->stalls, 0 );
+    atomic_init( &st->occ_sum, 0 );
+    atomic_init( &st->occ_max, 0 );
+
+    if ( pl->cnt > 0 ) {
+        prev = pl->stage[ pl->cnt - 1 ];
+        prev->out = st->in;
+        prev->out_done = &st->done;
+    }
+
+    pl->stage[ pl->cnt ] = st;
+
+    return pl->cnt++;
+}
+
+
+int rgpl_start( rgpl_t pl )
+{
+    if ( pl->state != rgpl_created || pl->cnt == 0 )
+        return rgpl_false;
+
+    pl->start = rgpl_now();
+
+    for ( int i = 0; i < pl->cnt; i++ ) {
+
+        if ( !rgpl_spawn( pl->stage[ i ] ) ) {
+
+            /*
+             * Started stages see closed input and exit. Last started
+             * stage has no consumer, so it discards its output.
+             */
+            if ( i > 0 )
+                atomic_store_explicit( &pl->stage[ i - 1 ]->discard, 1, memory_order_relaxed );
+            atomic_store_explicit( &pl->stage[ 0 ]->done, 1, memory_order_release );
+            for ( int j = 0; j < i; j++ )
+                pthread_join( pl->stage[ j ]->thread, NULL );
+
+            pl->state = rgpl_stopped;
+            pl->end = rgpl_now();
+
+            return rgpl_false;
+        }
+    }
+
+    pl->state = rgpl_running;
+
+    return rgpl_true;
+}
+
+
+int rgpl_push( rgpl_t pl, void* item )
+{
+    return rgs_put( pl->stage[ 0 ]->in, item );
+}
+
+
+rg_size_t rgpl_push_n( rgpl_t pl, void** items, rg_size_t n )
+{
+    return rgs_put_n( pl->stage[ 0 ]->in, items, n );
+}
+
+
+void rgpl_stop( rgpl_t pl )
+{
+    if ( pl->state != rgpl_running )
+        return;
+
+    /* Close propagates stage by stage, after each has drained. */
+    atomic_store_explicit( &pl->stage[ 0 ]->done, 1, memory_order_release );
+
+    for ( int i = 0; i < pl->cnt; i++ )
+        pthread_join( pl->stage[ i ]->thread, NULL );
+
+    pl->state = rgpl_stopped;
+    pl->end = rgpl_now();
+}
+
+
+int rgpl_stats( rgpl_t pl, int idx, rgpl_stats_s* stats )
+{
+    rgpl_stage_s* st;
+    rg_size_t     ns;
+
+    if ( idx < 0 || idx >= pl->cnt )
+        return rgpl_false;
+
+    st = pl->stage[ idx ];
+
+    stats->items = rgpl_load( st->items );
+    stats->batches = rgpl_load( st->batches );
+    stats->stalls = rgpl_load( st->stalls );
+    stats->queued = rgs_count( st->in );
+    stats->queued_max = rgpl_load( st->occ_max );
+    stats->queued_mean = stats->batches ? (double)rgpl_load( st->occ_sum ) / stats->batches : 0.0;
+
+    if ( pl->state == rgpl_created )
+        ns = 0;
+    else
+        ns = ( pl->state == rgpl_running ? rgpl_now() : pl->end ) - pl->start;
+
+    stats->rate = ns ? stats->items * 1e9 / ns : 0.0;
+
+    return rgpl_true;
+}
+
+
+
+
+/* ------------------------------------------------------------
+ * Internal functions:
+ */
+
+
+/**
+ * Stage thread.
+ *
+ * Input is drained before exit, and then output is closed.
+ */
+static void* rgpl_run( void* arg )
+{
+    rgpl_stage_s* st = arg;
+    rg_size_t     batch = st->pl->batch;
+    rg_size_t     n;
+    rg_size_t     m;
+    rg_size_t     off;
+    rg_size_t     occ;
+    void*         item;
+    int           done;
+    int           spin;
+
+    spin = 0;
+
+    for ( ;; ) {
+
+        /* Closed flag is read before items, so none are missed. */
+        done = atomic_load_explicit( &st->done, memory_order_acquire );
+
+        occ = rgs_count( st->in );
+        n = rgs_get_n( st->in, st->buf, batch );
+
+        if ( n == 0 ) {
+            if ( done )
+                break;
+            rgpl_idle( &spin );
+            continue;
+        }
+
+        spin = 0;
+
+        /* Results are collected in place, dropped items skipped. */
+        m = 0;
+        for ( rg_size_t i = 0; i < n; i++ ) {
+            item = st->fn( st->buf[ i ], st->ctx );
+            if ( item && st->out )
+                st->buf[ m++ ] = item;
+        }
+
+        off = 0;
+        while ( off < m && !atomic_load_explicit( &st->discard, memory_order_relaxed ) ) {
+            off += rgs_put_n( st->out, &st->buf[ off ], m - off );
+            if ( off < m ) {
+                rgpl_inc( st->stalls, 1 );
+                sched_yield();
+            }
+        }
+
+        rgpl_inc( st->items, n );
+        rgpl_inc( st->batches, 1 );
+        rgpl_inc( st->occ_sum, occ );
+        if ( occ > rgpl_load( st->occ_max ) )
+            rgpl_set( st->occ_max, occ );
+    }
+
+    if ( st->out_done )
+        atomic_store_explicit( st->out_done, 1, memory_order_release );
+
+    return NULL;
+}
+
+
+/**
+ * Create stage thread, pinned to its CPU.
+ */
+static int rgpl_spawn( rgpl_stage_s* st )
+{
+    pthread_attr_t attr;
+    int            ret;
+
+    pthread_attr_init( &attr );
+
+#ifdef __linux__
+    if ( st->cpu != RGPL_ANY_CPU ) {
+        cpu_set_t set;
+        if ( st->cpu < 0 || st->cpu >= CPU_SETSIZE ) {
+            pthread_attr_destroy( &attr );
+            return rgpl_false;
+        }
+        CPU_ZERO( &set );
+        CPU_SET( st->cpu, &set );
+        if ( pthread_attr_setaffinity_np( &attr, sizeof( set ), &set ) != 0 ) {
+            pthread_attr_destroy( &attr );
+            return rgpl_false;
+        }
+    }
+#endif
+
+    ret = pthread_create( &st->thread, &attr, rgpl_run, st );
+    pthread_attr_destroy( &attr );
+
+    return ret == 0;
+}
+
+
+/**
+ * Wait for input, first by yielding and then by sleeping.
+ */
+static void rgpl_idle( int* spin )
+{
+    struct timespec idle = { 0, rgpl_idle_ns };
+
+    if ( *spin < rgpl_spin_max ) {
+        ( *spin )++;
+        sched_yield();
+    } else {
+        nanosleep( &idle, NULL );
+    }
+}
+
+
+/**
+ * Return monotonic time in nanoseconds.
+ */
+static rg_size_t rgpl_now( void )
+{
+    struct timespec ts;
+
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+
+    return (rg_size_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
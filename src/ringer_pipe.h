@@ -0,0 +1,199 @@
+#ifndef RINGER_PIPE_H
+#define RINGER_PIPE_H
+
+/**
+ * @file   ringer_pipe.h
+ * @author agent <agent@local>
+ * @date   Sun Oct 18 14:49:04 2026
+ *
+ * @brief  Multi-stage pipeline over SPSC Ringers.
+ *
+ * Pipeline connects stage functions with SPSC Ringers. Each stage runs
+ * in its own thread, optionally pinned to a CPU. Stage thread gets a
+ * batch of items from its input Ringer, calls the stage function for
+ * each item, and puts the results to the input Ringer of the next
+ * stage as one batch.
+ *
+ *     rgpl_t pl = rgpl_new( 1024, 32 );
+ *     rgpl_add( pl, parse, NULL, 1 );
+ *     rgpl_add( pl, route, NULL, 2 );
+ *     rgpl_add( pl, emit, NULL, 3 );
+ *     rgpl_start( pl );
+ *     while ( ( msg = next_msg() ) )
+ *         while ( !rgpl_push( pl, msg ) )
+ *             sched_yield();
+ *     rgpl_stop( pl );
+ *
+ * Stage waits when the next stage's Ringer is full, hence a slow stage
+ * stops the stages before it, and finally rgpl_push() returns 0
+ * (backpressure). rgpl_stop() closes the Pipeline input, and each
+ * stage exits after it has processed all items from the previous
+ * stage, i.e. no items are lost.
+ *
+ */
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include "ringer_spsc.h"
+
+
+/** Maximum stage count. */
+#define RGPL_MAX_STAGES 32
+
+/** Stage is not pinned to CPU. */
+#define RGPL_ANY_CPU -1
+
+
+/**
+ * Stage function.
+ *
+ * Returned item is passed to the next stage, and NULL return drops the
+ * item. Return value of the last stage is ignored.
+ *
+ * @param item Item.
+ * @param ctx  Stage context.
+ *
+ * @return Item for the next stage (or NULL).
+ */
+typedef void* (*rgpl_stage_fn_t)( void* item, void* ctx );
+
+
+/**
+ * Stage metrics.
+ */
+struct rgpl_stats_s
+{
+    rg_size_t items;       /**< Processed items. */
+    rg_size_t batches;     /**< Processed batches. */
+    rg_size_t stalls;      /**< Waits for full output (backpressure). */
+    rg_size_t queued;      /**< Current input Ringer occupancy. */
+    rg_size_t queued_max;  /**< Maximum input occupancy at batch start. */
+    double    queued_mean; /**< Mean input occupancy at batch start. */
+    double    rate;        /**< Items per second since start. */
+};
+typedef struct rgpl_stats_s rgpl_stats_s; /**< Stage metrics struct. */
+
+
+typedef struct rgpl_stage_s rgpl_stage_s; /**< Stage struct (opaque). */
+
+
+/**
+ * Pipeline struct.
+ */
+struct rgpl_struct_s
+{
+    rg_size_t     size;                      /**< Ringer size. */
+    rg_size_t     batch;                     /**< Maximum batch size. */
+    int           cnt;                       /**< Stage count. */
+    int           state;                     /**< Created, running, or stopped. */
+    rg_size_t     start;                     /**< Start time (ns). */
+    rg_size_t     end;                       /**< Stop time (ns). */
+    rgpl_stage_s* stage[ RGPL_MAX_STAGES ];  /**< Stages. */
+};
+typedef struct rgpl_struct_s rgpl_s; /**< Pipeline struct. */
+typedef rgpl_s*              rgpl_t; /**< Pipeline pointer. */
+typedef rgpl_t*              rgpl_p; /**< Pipeline pointer reference. */
+
+
+
+/* ------------------------------------------------------------
+ * Pipeline:
+ */
+
+
+/**
+ * Create Pipeline.
+ *
+ * @param size  Ringer size between stages.
+ * @param batch Maximum items moved at once (0 for Ringer size).
+ *
+ * @return Pipeline.
+ */
+rgpl_t rgpl_new( rg_size_t size, rg_size_t batch );
+
+
+/**
+ * Destroy Pipeline.
+ *
+ * Running Pipeline is stopped first.
+ *
+ * @param plr Pipeline reference.
+ */
+void rgpl_destroy( rgpl_p plr );
+
+
+/**
+ * Add stage to the end of Pipeline.
+ *
+ * @param pl  Pipeline.
+ * @param fn  Stage function.
+ * @param ctx Stage context.
+ * @param cpu CPU for stage thread (or RGPL_ANY_CPU).
+ *
+ * @return Stage index (or -1 if Pipeline is started or full).
+ */
+int rgpl_add( rgpl_t pl, rgpl_stage_fn_t fn, void* ctx, int cpu );
+
+
+/**
+ * Start stage threads.
+ *
+ * If a stage can't be started, the started stages are stopped, and
+ * the output of the last started stage is discarded.
+ *
+ * @param pl Pipeline.
+ *
+ * @return 1 on success (0 if a thread could not be created or pinned).
+ */
+int rgpl_start( rgpl_t pl );
+
+
+/**
+ * Push item to Pipeline (single producer).
+ *
+ * @param pl   Pipeline.
+ * @param item Item.
+ *
+ * @return 1 on success (0 if first stage is full).
+ */
+int rgpl_push( rgpl_t pl, void* item );
+
+
+/**
+ * Push items to Pipeline (single producer).
+ *
+ * @param pl    Pipeline.
+ * @param items Item array.
+ * @param n     Item count.
+ *
+ * @return Number of items pushed.
+ */
+rg_size_t rgpl_push_n( rgpl_t pl, void** items, rg_size_t n );
+
+
+/**
+ * Drain and stop Pipeline.
+ *
+ * Returns after all pushed items have passed all stages, and stage
+ * threads have exited. Called by the producer after the last push.
+ *
+ * @param pl Pipeline.
+ */
+void rgpl_stop( rgpl_t pl );
+
+
+/**
+ * Return metrics of stage.
+ *
+ * Metrics are read while stages run, hence they are approximate.
+ *
+ * @param pl    Pipeline.
+ * @param idx   Stage index.
+ * @param stats Metrics storage.
+ *
+ * @return 1 on success (0 if no stage).
+ */
+int rgpl_stats( rgpl_t pl, int idx, rgpl_stats_s* stats );
+
+
+#endif
@@ -0,0 +1,289 @@
+/**
+ * @file   ringer_pool.c
+ * @author agent <agent@local>
+ * @date   Sun Oct 18 14:47:29 2026
+ *
+ * @brief  Object Pool with per-thread magazines.
+ *
+ */
+
+#include "ringer_pool.h"
+
+
+/**
+ * Thread cache.
+ *
+ * Objects are got from and put to loaded magazine. Previous magazine
+ * is either empty or full, and it is swapped with loaded when loaded
+ * runs out.
+ */
+struct rgp_cache_s
+{
+    rgp_t        pool;   /**< Object Pool. */
+    rg_t         loaded; /**< Loaded magazine. */
+    rg_t         prev;   /**< Previous magazine. */
+    rgp_cache_s* next;   /**< Next thread cache. */
+};
+
+
+static rgp_cache_s* rgp_cache( rgp_t p );
+static void rgp_cache_flush( rgp_t p, rgp_cache_s* cache );
+static void rgp_exit( void* cache );
+static void rgp_depot_put( rgp_t p, rg_t mag );
+static void rgp_mag_free( rg_t mag );
+
+
+
+/* ------------------------------------------------------------
+ * Object Pool:
+ */
+
+
+rgp_t rgp_new( rg_size_t obj_size, rg_size_t mag_size )
+{
+    rgp_t p;
+
+    if ( mag_size < RG_MIN_SIZE )
+        mag_size = RG_MIN_SIZE;
+
+    p = (rgp_t)rg_malloc( sizeof( rgp_s ) );
+
+    if ( pthread_key_create( &p->key, rgp_exit ) != 0 ) {
+        rg_free( p );
+        return NULL;
+    }
+
+    p->obj_size = obj_size;
+    p->mag_size = mag_size;
+    pthread_mutex_init( &p->mutex, NULL );
+    p->full = rg_new( RG_MIN_SIZE );
+    p->empty = rg_new( RG_MIN_SIZE );
+    p->caches = NULL;
+    atomic_init( &p->allocated, 0 );
+
+    return p;
+}
+
+
+void rgp_destroy( rgp_p pr )
+{
+    rgp_t        p = *pr;
+    rgp_cache_s* cache;
+    rg_t         mag;
+
+    pthread_key_delete( p->key );
+
+    while ( p->caches ) {
+        cache = p->caches;
+        p->caches = cache->next;
+        rgp_mag_free( cache->loaded );
+        rgp_mag_free( cache->prev );
+        rg_free( cache );
+    }
+
+    while ( ( mag = rg_get( p->full ) ) )
+        rgp_mag_free( mag );
+    while ( ( mag = rg_get( p->empty ) ) )
+        rgp_mag_free( mag );
+
+    rg_destroy( &p->full );
+    rg_destroy( &p->empty );
+    pthread_mutex_destroy( &p->mutex );
+    rg_free( p );
+    *pr = NULL;
+}
+
+
+void* rgp_get( rgp_t p )
+{
+    rgp_cache_s* cache;
+    rg_t         mag;
+
+    cache = rgp_cache( p );
+
+    if ( rg_is_empty( cache->loaded ) ) {
+
+        if ( !rg_is_empty( cache->prev ) ) {
+
+            /* Previous is full. */
+            mag = cache->prev;
+            cache->prev = cache->loaded;
+            cache->loaded = mag;
+
+        } else {
+
+            /* Both empty, exchange empty for full. */
+            pthread_mutex_lock( &p->mutex );
+            mag = rg_get( p->full );
+            if ( mag )
+                rg_ram( &p->empty, cache->prev );
+            pthread_mutex_unlock( &p->mutex );
+
+            if ( mag == NULL ) {
+                atomic_fetch_add_explicit( &p->allocated, 1, memory_order_relaxed );
+                return rg_malloc( p->obj_size );
+            }
+
+            cache->prev = cache->loaded;
+            cache->loaded = mag;
+        }
+    }
+
+    /* Last put first, while it is still in cache. */
+    return rg_get_back( cache->loaded );
+}
+
+
+void rgp_put( rgp_t p, void* obj )
+{
+    rgp_cache_s* cache;
+    rg_t         mag;
+
+    cache = rgp_cache( p );
+
+    if ( rg_is_full( cache->loaded ) ) {
+
+        if ( rg_is_empty( cache->prev ) ) {
+
+            /* Previous is empty. */
+            mag = cache->prev;
+            cache->prev = cache->loaded;
+            cache->loaded = mag;
+
+        } else {
+
+            /* Both full, exchange full for empty. */
+            pthread_mutex_lock( &p->mutex );
+            mag = rg_get( p->empty );
+            rg_ram( &p->full, cache->prev );
+            pthread_mutex_unlock( &p->mutex );
+
+            if ( mag == NULL )
+                mag = rg_new( p->mag_size );
+
+            cache->prev = cache->loaded;
+            cache->loaded = mag;
+        }
+    }
+
+    rg_put( cache->loaded, obj );
+}
+
+
+void rgp_flush( rgp_t p )
+{
+    rgp_cache_flush( p, rgp_cache( p ) );
+}
+
+
+rg_size_t rgp_allocated( rgp_t p )
+{
+    return atomic_load_explicit( &p->allocated, memory_order_relaxed );
+}
+
+
+
+
+/* ------------------------------------------------------------
+ * Internal functions:
+ */
+
+
+/**
+ * Return thread cache, create at first call.
+ */
+static rgp_cache_s* rgp_cache( rgp_t p )
+{
+    rgp_cache_s* cache;
+
+    cache = (rgp_cache_s*)pthread_getspecific( p->key );
+
+    if ( cache == NULL ) {
+
+        cache = (rgp_cache_s*)rg_malloc( sizeof( rgp_cache_s ) );
+        cache->pool = p;
+        cache->loaded = rg_new( p->mag_size );
+        cache->prev = rg_new( p->mag_size );
+
+        pthread_mutex_lock( &p->mutex );
+        cache->next = p->caches;
+        p->caches = cache;
+        pthread_mutex_unlock( &p->mutex );
+
+        pthread_setspecific( p->key, cache );
+    }
+
+    return cache;
+}
+
+
+/**
+ * Move objects of thread cache to depot.
+ *
+ * Partial magazines are stored as non-empty, and they are consumed
+ * like full magazines.
+ */
+static void rgp_cache_flush( rgp_t p, rgp_cache_s* cache )
+{
+    pthread_mutex_lock( &p->mutex );
+    rgp_depot_put( p, cache->loaded );
+    rgp_depot_put( p, cache->prev );
+    cache->loaded = rg_get( p->empty );
+    cache->prev = rg_get( p->empty );
+    pthread_mutex_unlock( &p->mutex );
+
+    if ( cache->loaded == NULL )
+        cache->loaded = rg_new( p->mag_size );
+    if ( cache->prev == NULL )
+        cache->prev = rg_new( p->mag_size );
+}
+
+
+/**
+ * Flush and release thread cache at thread exit.
+ */
+static void rgp_exit( void* arg )
+{
+    rgp_cache_s*  cache = arg;
+    rgp_t         p = cache->pool;
+    rgp_cache_s** link;
+
+    pthread_mutex_lock( &p->mutex );
+
+    rgp_depot_put( p, cache->loaded );
+    rgp_depot_put( p, cache->prev );
+
+    for ( link = &p->caches; *link != cache; link = &( *link )->next )
+        ;
+    *link = cache->next;
+
+    pthread_mutex_unlock( &p->mutex );
+
+    rg_free( cache );
+}
+
+
+/**
+ * Store magazine to depot (locked).
+ */
+static void rgp_depot_put( rgp_t p, rg_t mag )
+{
+    if ( rg_is_empty( mag ) )
+        rg_ram( &p->empty, mag );
+    else
+        rg_ram( &p->full, mag );
+}
+
+
+/**
+ * Release magazine and its objects.
+ */
+static void rgp_mag_free( rg_t mag )
+{
+    void* obj;
+
+    while ( ( obj = rg_get( mag ) ) )
+        rg_free( obj );
+
+    rg_destroy( &mag );
+}
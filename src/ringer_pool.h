@@ -0,0 +1,118 @@
+#ifndef RINGER_POOL_H
+#define RINGER_POOL_H
+
+/**
+ * @file   ringer_pool.h
+ * @author agent <agent@local>
+ * @date   Sun Oct 18 14:47:29 2026
+ *
+ * @brief  Object Pool with per-thread magazines.
+ *
+ * Object Pool recycles fixed size objects. Each thread caches objects
+ * in two magazines, which are Ringers of objects. Objects are got
+ * from and put to the magazines of the thread without locking. Only
+ * when both magazines are empty (or full), the thread exchanges a
+ * magazine with the shared depot under a lock, i.e. the lock is taken
+ * once per magazine of objects.
+ *
+ * Objects are allocated when depot has no objects, and they are
+ * released when Object Pool is destroyed.
+ *
+ */
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include "ringer.h"
+
+
+typedef struct rgp_cache_s rgp_cache_s; /**< Thread cache struct (opaque). */
+
+
+/**
+ * Object Pool struct.
+ */
+struct rgp_struct_s
+{
+    rg_size_t         obj_size;  /**< Object size. */
+    rg_size_t         mag_size;  /**< Magazine size. */
+    pthread_key_t     key;       /**< Thread cache key. */
+    pthread_mutex_t   mutex;     /**< Depot lock. */
+    rg_t              full;      /**< Depot of non-empty magazines. */
+    rg_t              empty;     /**< Depot of empty magazines. */
+    rgp_cache_s*      caches;    /**< Thread caches. */
+    _Atomic rg_size_t allocated; /**< Allocated objects. */
+};
+typedef struct rgp_struct_s rgp_s; /**< Object Pool struct. */
+typedef rgp_s*              rgp_t; /**< Object Pool pointer. */
+typedef rgp_t*              rgp_p; /**< Object Pool pointer reference. */
+
+
+
+/* ------------------------------------------------------------
+ * Object Pool:
+ */
+
+
+/**
+ * Create Object Pool.
+ *
+ * @param obj_size Object size in bytes.
+ * @param mag_size Magazine size, i.e. objects exchanged with depot
+ *                 at once.
+ *
+ * @return Object Pool (or NULL if thread key can't be created).
+ */
+rgp_t rgp_new( rg_size_t obj_size, rg_size_t mag_size );
+
+
+/**
+ * Destroy Object Pool.
+ *
+ * All objects in the Pool are released. Objects must have been put
+ * back, and threads must have stopped using the Pool.
+ *
+ * @param pr Object Pool reference.
+ */
+void rgp_destroy( rgp_p pr );
+
+
+/**
+ * Get object from Object Pool.
+ *
+ * @param p Object Pool.
+ *
+ * @return Object.
+ */
+void* rgp_get( rgp_t p );
+
+
+/**
+ * Put object back to Object Pool.
+ *
+ * @param p   Object Pool.
+ * @param obj Object.
+ */
+void rgp_put( rgp_t p, void* obj );
+
+
+/**
+ * Return objects cached by calling thread to depot.
+ *
+ * Thread cache is flushed automatically when thread exits.
+ *
+ * @param p Object Pool.
+ */
+void rgp_flush( rgp_t p );
+
+
+/**
+ * Return count of allocated objects.
+ *
+ * @param p Object Pool.
+ *
+ * @return Count.
+ */
+rg_size_t rgp_allocated( rgp_t p );
+
+
+#endif
@@ -0,0 +1,215 @@
+/**
+ * @file   ringer_prio.c
+ * @author agent <agent@local>
+ * @date   Sun Oct 18 14:51:43 2026
+ *
+ * @brief  Priority Ringer with bitmap of non-empty lanes.
+ *
+ */
+
+#include "ringer_prio.h"
+
+
+/* clang-format off */
+
+/** @cond ringer_none */
+#define rgpr_true           1
+#define rgpr_false          0
+#define rgpr_bit( lane )    ( (uint64_t)1 << ( 63 - ( lane ) ) )
+#define rgpr_first( bits )  __builtin_clzll( bits )
+/** @endcond ringer_none */
+
+/* clang-format on */
+
+
+static void* rgpr_take( rgpr_t pr, int lane );
+
+
+
+/* ------------------------------------------------------------
+ * Priority Ringer:
+ */
+
+
+rgpr_t rgpr_new( int lanes, rg_size_t size, int grow )
+{
+    rgpr_t pr;
+
+    if ( lanes < 1 || lanes > RGPR_MAX_LANES || size < RG_MIN_SIZE )
+        return NULL;
+
+    pr = (rgpr_t)rg_malloc( sizeof( rgpr_s ) + lanes * sizeof( rgpr_lane_s ) );
+
+    pr->bits = 0;
+    pr->cnt = 0;
+    pr->lanes = lanes;
+
+    /* First round robin pick wraps to lane 0. */
+    pr->cur = lanes - 1;
+    pr->credit = 0;
+
+    for ( int i = 0; i < lanes; i++ ) {
+        pr->lane[ i ].rg = rg_new( size );
+        pr->lane[ i ].weight = 1;
+        pr->lane[ i ].grow = grow;
+    }
+
+    return pr;
+}
+
+
+void rgpr_destroy( rgpr_p prr )
+{
+    rgpr_t pr = *prr;
+
+    for ( int i = 0; i < pr->lanes; i++ )
+        rg_destroy( &pr->lane[ i ].rg );
+
+    rg_free( pr );
+    *prr = NULL;
+}
+
+
+int rgpr_put( rgpr_t pr, int lane, void* item )
+{
+    if ( lane < 0 || lane >= pr->lanes )
+        return rgpr_false;
+
+    if ( pr->lane[ lane ].grow )
+        rg_ram( &pr->lane[ lane ].rg, item );
+    else if ( !rg_put( pr->lane[ lane ].rg, item ) )
+        return rgpr_false;
+
+    pr->bits |= rgpr_bit( lane );
+    pr->cnt++;
+
+    return rgpr_true;
+}
+
+
+void* rgpr_get( rgpr_t pr, int* lane )
+{
+    int first;
+
+    if ( pr->bits == 0 )
+        return NULL;
+
+    first = rgpr_first( pr->bits );
+    if ( lane )
+        *lane = first;
+
+    return rgpr_take( pr, first );
+}
+
+
+void* rgpr_get_wrr( rgpr_t pr, int* lane )
+{
+    uint64_t after;
+
+    if ( pr->bits == 0 )
+        return NULL;
+
+    if ( pr->credit == 0 || !( pr->bits & rgpr_bit( pr->cur ) ) ) {
+
+        /* Next non-empty lane after current, or wrap. */
+        after = pr->bits & ( rgpr_bit( pr->cur ) - 1 );
+        pr->cur = rgpr_first( after ? after : pr->bits );
+        pr->credit = pr->lane[ pr->cur ].weight;
+    }
+
+    pr->credit--;
+    if ( lane )
+        *lane = pr->cur;
+
+    return rgpr_take( pr, pr->cur );
+}
+
+
+void* rgpr_peek( rgpr_t pr, int* lane )
+{
+    int first;
+
+    if ( pr->bits == 0 )
+        return NULL;
+
+    first = rgpr_first( pr->bits );
+    if ( lane )
+        *lane = first;
+
+    return rg_peek( pr->lane[ first ].rg );
+}
+
+
+int rgpr_set_weight( rgpr_t pr, int lane, rg_size_t weight )
+{
+    if ( lane < 0 || lane >= pr->lanes || weight == 0 )
+        return rgpr_false;
+
+    pr->lane[ lane ].weight = weight;
+
+    return rgpr_true;
+}
+
+
+int rgpr_set_lane( rgpr_t pr, int lane, rg_size_t size, int grow )
+{
+    if ( lane < 0 || lane >= pr->lanes || size < RG_MIN_SIZE )
+        return rgpr_false;
+
+    if ( size != rg_size( pr->lane[ lane ].rg ) && !rg_resize( &pr->lane[ lane ].rg, size ) )
+        return rgpr_false;
+
+    pr->lane[ lane ].grow = grow;
+
+    return rgpr_true;
+}
+
+
+rg_size_t rgpr_count( rgpr_t pr )
+{
+    return pr->cnt;
+}
+
+
+rg_size_t rgpr_lane_count( rgpr_t pr, int lane )
+{
+    if ( lane < 0 || lane >= pr->lanes )
+        return 0;
+
+    return rg_count( pr->lane[ lane ].rg );
+}
+
+
+int rgpr_is_empty( rgpr_t pr )
+{
+    return pr->bits == 0;
+}
+
+
+int rgpr_lanes( rgpr_t pr )
+{
+    return pr->lanes;
+}
+
+
+
+
+/* ------------------------------------------------------------
+ * Internal functions:
+ */
+
+
+/**
+ * Get item from non-empty lane, and clear lane bit if emptied.
+ */
+static void* rgpr_take( rgpr_t pr, int lane )
+{
+    void* item;
+
+    item = rg_get( pr->lane[ lane ].rg );
+    if ( rg_is_empty( pr->lane[ lane ].rg ) )
+        pr->bits &= ~rgpr_bit( lane );
+    pr->cnt--;
+
+    return item;
+}
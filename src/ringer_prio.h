@@ -0,0 +1,210 @@
+#ifndef RINGER_PRIO_H
+#define RINGER_PRIO_H
+
+/**
+ * @file   ringer_prio.h
+ * @author agent <agent@local>
+ * @date   Sun Oct 18 14:51:43 2026
+ *
+ * @brief  Priority Ringer with bitmap of non-empty lanes.
+ *
+ * Priority Ringer has up to 64 lanes, and each lane is a Ringer. Lane
+ * 0 has the highest priority. Bitmap has a bit for each non-empty
+ * lane, and the bit of lane is (63 - lane). Hence the highest
+ * priority non-empty lane is found with one count-leading-zeros, and
+ * get cost does not depend on lane count.
+ *
+ *     rgpr_t pr = rgpr_new( 4, 256, 0 );
+ *     rgpr_put( pr, 2, item );
+ *     item = rgpr_get( pr, NULL );
+ *
+ * Strict priority (rgpr_get()) may starve low priority lanes.
+ * rgpr_get_wrr() serves lanes in weighted round robin, where a lane
+ * gets up to its weight of items per round.
+ *
+ */
+
+#include "ringer.h"
+
+
+/** Maximum lane count. */
+#define RGPR_MAX_LANES 64
+
+
+/**
+ * Priority Ringer lane.
+ */
+struct rgpr_lane_s
+{
+    rg_t      rg;     /**< Lane Ringer. */
+    rg_size_t weight; /**< Items per round robin round. */
+    int       grow;   /**< Lane grows when full. */
+};
+typedef struct rgpr_lane_s rgpr_lane_s; /**< Priority Ringer lane struct. */
+
+
+/**
+ * Priority Ringer struct.
+ */
+struct rgpr_struct_s
+{
+    uint64_t    bits;      /**< Non-empty lanes, bit (63 - lane). */
+    rg_size_t   cnt;       /**< Total item count. */
+    int         lanes;     /**< Lane count. */
+    int         cur;       /**< Current round robin lane. */
+    rg_size_t   credit;    /**< Items left for current lane. */
+    rgpr_lane_s lane[ 0 ]; /**< Lanes. */
+};
+typedef struct rgpr_struct_s rgpr_s; /**< Priority Ringer struct. */
+typedef rgpr_s*              rgpr_t; /**< Priority Ringer pointer. */
+typedef rgpr_t*              rgpr_p; /**< Priority Ringer pointer reference. */
+
+
+
+/* ------------------------------------------------------------
+ * Priority Ringer:
+ */
+
+
+/**
+ * Create Priority Ringer.
+ *
+ * Lane weights are 1 (plain round robin). Size and grow are defaults
+ * for all lanes, see rgpr_set_lane().
+ *
+ * @param lanes Lane count (1 to RGPR_MAX_LANES).
+ * @param size  Lane size (at least RG_MIN_SIZE).
+ * @param grow  Lanes grow with rg_ram() when full (if 1).
+ *
+ * @return Priority Ringer (or NULL for invalid lane count or size).
+ */
+rgpr_t rgpr_new( int lanes, rg_size_t size, int grow );
+
+
+/**
+ * Destroy Priority Ringer.
+ *
+ * @param prr Priority Ringer reference.
+ */
+void rgpr_destroy( rgpr_p prr );
+
+
+/**
+ * Put item to lane.
+ *
+ * @param pr   Priority Ringer.
+ * @param lane Lane.
+ * @param item Item.
+ *
+ * @return 1 on success (0 if lane is full or invalid).
+ */
+int rgpr_put( rgpr_t pr, int lane, void* item );
+
+
+/**
+ * Get item from the highest priority non-empty lane.
+ *
+ * @param pr   Priority Ringer.
+ * @param lane Lane of item (if not NULL).
+ *
+ * @return Item (or NULL if empty).
+ */
+void* rgpr_get( rgpr_t pr, int* lane );
+
+
+/**
+ * Get item in weighted round robin order.
+ *
+ * Current lane is served until it has given its weight of items or
+ * it is empty, and then the next non-empty lane is selected.
+ *
+ * @param pr   Priority Ringer.
+ * @param lane Lane of item (if not NULL).
+ *
+ * @return Item (or NULL if empty).
+ */
+void* rgpr_get_wrr( rgpr_t pr, int* lane );
+
+
+/**
+ * Peek item from the highest priority non-empty lane.
+ *
+ * No changes to Priority Ringer state.
+ *
+ * @param pr   Priority Ringer.
+ * @param lane Lane of item (if not NULL).
+ *
+ * @return Item (or NULL if empty).
+ */
+void* rgpr_peek( rgpr_t pr, int* lane );
+
+
+/**
+ * Set round robin weight of lane.
+ *
+ * @param pr     Priority Ringer.
+ * @param lane   Lane.
+ * @param weight Weight (at least 1).
+ *
+ * @return 1 on success (0 if lane or weight is invalid).
+ */
+int rgpr_set_weight( rgpr_t pr, int lane, rg_size_t weight );
+
+
+/**
+ * Set size and growth of lane.
+ *
+ * Items in lane are kept.
+ *
+ * @param pr   Priority Ringer.
+ * @param lane Lane.
+ * @param size Lane size (at least RG_MIN_SIZE and lane item count).
+ * @param grow Lane grows with rg_ram() when full (if 1).
+ *
+ * @return 1 on success (0 if lane or size is invalid).
+ */
+int rgpr_set_lane( rgpr_t pr, int lane, rg_size_t size, int grow );
+
+
+/**
+ * Return item count of Priority Ringer.
+ *
+ * @param pr Priority Ringer.
+ *
+ * @return Count.
+ */
+rg_size_t rgpr_count( rgpr_t pr );
+
+
+/**
+ * Return item count of lane.
+ *
+ * @param pr   Priority Ringer.
+ * @param lane Lane.
+ *
+ * @return Count (0 for invalid lane).
+ */
+rg_size_t rgpr_lane_count( rgpr_t pr, int lane );
+
+
+/**
+ * Is Priority Ringer empty?
+ *
+ * @param pr Priority Ringer.
+ *
+ * @return 1 if empty.
+ */
+int rgpr_is_empty( rgpr_t pr );
+
+
+/**
+ * Return lane count of Priority Ringer.
+ *
+ * @param pr Priority Ringer.
+ *
+ * @return Lane count.
+ */
+int rgpr_lanes( rgpr_t pr );
+
+
+#endif
@@ -0,0 +1,283 @@
+/**
+ * @file   ringer_shard.c
+ * @author agent <agent@local>
+ * @date   Sun Oct 18 14:30:47 2026
+ *
+ * @brief  Sharded multi producer single consumer Ringer.
+ *
+ */
+
+#define _GNU_SOURCE
+#include <sched.h>
+#include <unistd.h>
+#include "ringer_shard.h"
+
+
+/* clang-format off */
+
+/** @cond ringer_none */
+#define rgsh_true  1
+#define rgsh_false 0
+#define rgsh_struct_size(cnt) ( sizeof(rgsh_s) + cnt*sizeof(rgsh_shard_s) )
+/** @endcond ringer_none */
+
+/* clang-format on */
+
+
+/**
+ * Producer state.
+ */
+struct rgsh_prod_s
+{
+    int                 shard; /**< Current shard. */
+    rg_size_t           last;  /**< Write Index after latest put to shard. */
+    struct rgsh_prod_s* next;  /**< Next producer state. */
+};
+typedef struct rgsh_prod_s rgsh_prod_s;
+typedef rgsh_prod_s*       rgsh_prod_t;
+
+
+static rgsh_prod_t rgsh_producer( rgsh_t rh );
+static int rgsh_drained( rgsh_t rh, rgsh_prod_t prod );
+static int rgsh_shard_put( rgsh_shard_s* shard, void* item, rg_size_t* last );
+
+
+
+/* ------------------------------------------------------------
+ * Shard Ringer:
+ */
+
+
+rgsh_t rgsh_new( int shards, rg_size_t size, rg_size_t batch )
+{
+    rgsh_t rh;
+
+    if ( shards <= 0 ) {
+        shards = sysconf( _SC_NPROCESSORS_CONF );
+        if ( shards <= 0 )
+            shards = 1;
+    }
+
+    rh = (rgsh_t)rg_malloc( rgsh_struct_size( shards ) );
+
+    /* Producer states are owned by Shard Ringer, not by the key. */
+    if ( pthread_key_create( &rh->key, NULL ) != 0 ) {
+        rg_free( rh );
+        return NULL;
+    }
+
+    rh->cnt = shards;
+    rh->next = 0;
+    rh->batch = batch;
+    atomic_init( &rh->prods, NULL );
+
+    for ( int i = 0; i < shards; i++ ) {
+        rh->shard[ i ].rs = rgs_new( size );
+        atomic_init( &rh->shard[ i ].lock, 0 );
+    }
+
+    if ( rh->batch == 0 )
+        rh->batch = rgs_size( rh->shard[ 0 ].rs );
+
+    return rh;
+}
+
+
+void rgsh_destroy( rgsh_p rhr )
+{
+    rgsh_t      rh = *rhr;
+    rgsh_prod_t prod;
+    rgsh_prod_t next;
+
+    pthread_key_delete( rh->key );
+
+    for ( prod = atomic_load( &rh->prods ); prod; prod = next ) {
+        next = prod->next;
+        rg_free( prod );
+    }
+
+    for ( int i = 0; i < rh->cnt; i++ )
+        rgs_destroy( &rh->shard[ i ].rs );
+
+    rg_free( rh );
+    *rhr = NULL;
+}
+
+
+int rgsh_put( rgsh_t rh, void* item )
+{
+    rgsh_prod_t prod;
+    int         cpu;
+    int         idx;
+
+    prod = rgsh_producer( rh );
+
+    cpu = sched_getcpu();
+    if ( cpu >= 0 && cpu % rh->cnt != prod->shard && rgsh_drained( rh, prod ) ) {
+        prod->shard = cpu % rh->cnt;
+        prod->last = 0;
+    }
+
+    idx = prod->shard;
+
+    for ( int i = 0; i < rh->cnt; i++ ) {
+
+        if ( rgsh_shard_put( &rh->shard[ idx ], item, &prod->last ) ) {
+            prod->shard = idx;
+            return rgsh_true;
+        }
+
+        /* Fall back to neighbour only if ordering is preserved. */
+        if ( !rgsh_drained( rh, prod ) )
+            break;
+
+        idx = ( idx + 1 ) % rh->cnt;
+    }
+
+    return rgsh_false;
+}
+
+
+void* rgsh_get( rgsh_t rh )
+{
+    void* item;
+
+    if ( rgsh_get_n( rh, &item, 1 ) )
+        return item;
+    else
+        return NULL;
+}
+
+
+rg_size_t rgsh_get_n( rgsh_t rh, void** items, rg_size_t n )
+{
+    rg_size_t got;
+    rg_size_t cnt;
+    rg_size_t max;
+    int       idle;
+
+    got = 0;
+    idle = 0;
+
+    /* Stop when n items are got or all shards were found empty. */
+    while ( got < n && idle < rh->cnt ) {
+
+        max = n - got;
+        if ( max > rh->batch )
+            max = rh->batch;
+
+        cnt = rgs_get_n( rh->shard[ rh->next ].rs, &items[ got ], max );
+        got += cnt;
+
+        if ( cnt == 0 )
+            idle++;
+        else
+            idle = 0;
+
+        if ( cnt < max || cnt == rh->batch )
+            rh->next = ( rh->next + 1 ) % rh->cnt;
+    }
+
+    return got;
+}
+
+
+rg_size_t rgsh_count( rgsh_t rh )
+{
+    rg_size_t cnt = 0;
+
+    for ( int i = 0; i < rh->cnt; i++ )
+        cnt += rgs_count( rh->shard[ i ].rs );
+
+    return cnt;
+}
+
+
+int rgsh_is_empty( rgsh_t rh )
+{
+    return rgsh_count( rh ) == 0;
+}
+
+
+int rgsh_shards( rgsh_t rh )
+{
+    return rh->cnt;
+}
+
+
+
+
+/* ------------------------------------------------------------
+ * Internal functions:
+ */
+
+
+/**
+ * Return state of the calling producer thread.
+ */
+static rgsh_prod_t rgsh_producer( rgsh_t rh )
+{
+    rgsh_prod_t prod;
+    int         cpu;
+
+    prod = (rgsh_prod_t)pthread_getspecific( rh->key );
+
+    if ( prod == NULL ) {
+        prod = (rgsh_prod_t)rg_malloc( sizeof( rgsh_prod_s ) );
+        cpu = sched_getcpu();
+        prod->shard = ( cpu >= 0 ) ? cpu % rh->cnt : 0;
+        prod->last = 0;
+        pthread_setspecific( rh->key, prod );
+
+        /* Link to Shard Ringer for release. */
+        prod->next = atomic_load_explicit( &rh->prods, memory_order_relaxed );
+        while ( !atomic_compare_exchange_weak_explicit(
+            &rh->prods, &prod->next, prod, memory_order_release, memory_order_relaxed ) )
+            ;
+    }
+
+    return prod;
+}
+
+
+/**
+ * Have all items of producer been got from its current shard?
+ */
+static int rgsh_drained( rgsh_t rh, rgsh_prod_t prod )
+{
+    rg_size_t ridx;
+
+    ridx = atomic_load_explicit( &rh->shard[ prod->shard ].rs->ridx, memory_order_acquire );
+
+    return ( ridx >= prod->last );
+}
+
+
+/**
+ * Put item to shard.
+ *
+ * Shard is locked, since producers from the same CPU may share the
+ * shard due to preemption and migration. Lock is normally uncontended
+ * and in cache of the current CPU.
+ */
+static int rgsh_shard_put( rgsh_shard_s* shard, void* item, rg_size_t* last )
+{
+    int ret;
+    int unlocked;
+
+    for ( ;; ) {
+        unlocked = 0;
+        if ( atomic_compare_exchange_weak_explicit(
+                 &shard->lock, &unlocked, 1, memory_order_acquire, memory_order_relaxed ) )
+            break;
+        sched_yield();
+    }
+
+    ret = rgs_put( shard->rs, item );
+    if ( ret )
+        *last = atomic_load_explicit( &shard->rs->widx, memory_order_relaxed );
+
+    atomic_store_explicit( &shard->lock, 0, memory_order_release );
+
+    return ret;
+}
@@ -0,0 +1,156 @@
+#ifndef RINGER_SHARD_H
+#define RINGER_SHARD_H
+
+/**
+ * @file   ringer_shard.h
+ * @author agent <agent@local>
+ * @date   Sun Oct 18 14:30:47 2026
+ *
+ * @brief  Sharded multi producer single consumer Ringer.
+ *
+ * Shard Ringer has one SPSC Ringer (shard) per CPU. Producers put to
+ * the shard of the current CPU, hence producers on different CPUs do
+ * not share cache lines. Consumer gets from all shards in round-robin
+ * order.
+ *
+ * Items from one producer thread are got in the order they were put.
+ * There is no ordering between producers.
+ *
+ */
+
+#include <pthread.h>
+#include "ringer_spsc.h"
+
+
+/**
+ * Shard of Shard Ringer.
+ */
+struct rgsh_shard_s
+{
+    rgs_t      rs;   /**< Shard storage. */
+    atomic_int lock; /**< Producer lock. */
+    /** @cond ringer_none */
+    char pad[ RG_CACHE_LINE - sizeof( rgs_t ) - sizeof( atomic_int ) ];
+    /** @endcond ringer_none */
+};
+typedef struct rgsh_shard_s rgsh_shard_s; /**< Shard struct. */
+
+
+/**
+ * Shard Ringer struct.
+ */
+struct rgsh_struct_s
+{
+    int                            cnt;        /**< Shard count. */
+    int                            next;       /**< Next shard for consumer. */
+    rg_size_t                      batch;      /**< Consumer batch size per shard. */
+    pthread_key_t                  key;        /**< Producer state key. */
+    _Atomic( struct rgsh_prod_s* ) prods;      /**< Producer states. */
+    rgsh_shard_s                   shard[ 0 ]; /**< Shards. */
+};
+typedef struct rgsh_struct_s rgsh_s; /**< Shard Ringer struct. */
+typedef rgsh_s*              rgsh_t; /**< Shard Ringer pointer. */
+typedef rgsh_t*              rgsh_p; /**< Shard Ringer pointer reference. */
+
+
+
+/* ------------------------------------------------------------
+ * Shard Ringer:
+ */
+
+
+/**
+ * Create Shard Ringer.
+ *
+ * @param shards Shard count (0 for CPU count).
+ * @param size   Size of each shard.
+ * @param batch  Consumer batch size per shard (0 for shard size).
+ *
+ * @return Shard Ringer (or NULL if producer state key can't be created).
+ */
+rgsh_t rgsh_new( int shards, rg_size_t size, rg_size_t batch );
+
+
+/**
+ * Destroy Shard Ringer.
+ *
+ * Producers and consumer must be stopped. Producer states are
+ * released here, also for producer threads that have exited.
+ *
+ * @param rhr Shard Ringer reference.
+ */
+void rgsh_destroy( rgsh_p rhr );
+
+
+/**
+ * Put item to Shard Ringer (producer).
+ *
+ * Item is put to the shard of the current CPU. If the shard is full,
+ * the following shards are tried. Producer changes shard only when
+ * all its items in the previous shard are got, since otherwise items
+ * from the producer could be got out of order.
+ *
+ * @param rh   Shard Ringer.
+ * @param item Item.
+ *
+ * @return 1 on success (0 if full).
+ */
+int rgsh_put( rgsh_t rh, void* item );
+
+
+/**
+ * Get item from Shard Ringer (consumer).
+ *
+ * @param rh Shard Ringer.
+ *
+ * @return Item (or NULL if empty).
+ */
+void* rgsh_get( rgsh_t rh );
+
+
+/**
+ * Get items from Shard Ringer (consumer).
+ *
+ * Shards are drained in round-robin order, at most batch size items
+ * from each shard at a time.
+ *
+ * @param rh    Shard Ringer.
+ * @param items Item array.
+ * @param n     Maximum item count.
+ *
+ * @return Number of items got.
+ */
+rg_size_t rgsh_get_n( rgsh_t rh, void** items, rg_size_t n );
+
+
+/**
+ * Return item count of Shard Ringer.
+ *
+ * @param rh Shard Ringer.
+ *
+ * @return Count.
+ */
+rg_size_t rgsh_count( rgsh_t rh );
+
+
+/**
+ * Is Shard Ringer empty?
+ *
+ * @param rh Shard Ringer.
+ *
+ * @return 1 if empty.
+ */
+int rgsh_is_empty( rgsh_t rh );
+
+
+/**
+ * Return Shard Ringer shard count.
+ *
+ * @param rh Shard Ringer.
+ *
+ * @return Shard count.
+ */
+int rgsh_shards( rgsh_t rh );
+
+
+#endif
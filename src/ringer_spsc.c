@@ -0,0 +1,292 @@
+/**
+ * @file   ringer_spsc.c
+ * @author agent <agent@local>
+ * @date   Sun Oct 18 14:30:47 2026
+ *
+ * @brief  Single producer single consumer Ringer.
+ *
+ */
+
+#include <string.h>
+#include "ringer_spsc.h"
+
+
+/* clang-format off */
+
+/** @cond ringer_none */
+#define rgs_true  1
+#define rgs_false 0
+#define rgs_struct_size(size) ( sizeof(rgs_s) + size*sizeof(void*) )
+#define rgs_unit_size         ( sizeof( void* ) )
+#define rgs_nth( rs, pos )    rs->data[ ( pos ) & rs->mask ]
+#define rgs_load( var, mo )   atomic_load_explicit( &( var ), memory_order_##mo )
+#define rgs_store( var, val, mo ) atomic_store_explicit( &( var ), ( val ), memory_order_##mo )
+#define rgs_slot_set( rs, pos, item ) __atomic_store_n( &rgs_nth( rs, pos ), ( item ), __ATOMIC_RELEASE )
+#define rgs_slot_fill( rs, pos, item ) __atomic_store_n( &rs->data[ pos ], ( item ), __ATOMIC_RELAXED )
+#define rgs_slot_get( rs, pos )   __atomic_load_n( &rgs_nth( rs, pos ), __ATOMIC_RELAXED )
+/** @endcond ringer_none */
+
+/* clang-format on */
+
+
+static rg_size_t rgs_space( rgs_t rs, rg_size_t widx, rg_size_t need );
+static rg_size_t rgs_avail( rgs_t rs, rg_size_t ridx, rg_size_t need );
+
+
+
+/* ------------------------------------------------------------
+ * SPSC Ringer:
+ */
+
+
+rgs_t rgs_new( rg_size_t size )
+{
+    rgs_t     rs;
+    rg_size_t pow;
+
+    pow = RG_MIN_SIZE;
+    while ( pow < size )
+        pow <<= 1;
+
+    rs = (rgs_t)rg_malloc( rgs_struct_size( pow ) );
+
+    atomic_init( &rs->widx, 0 );
+    atomic_init( &rs->ridx, 0 );
+    rs->rcache = 0;
+    rs->wcache = 0;
+    rs->size = pow;
+    rs->mask = pow - 1;
+
+    return rs;
+}
+
+
+void rgs_destroy( rgs_p rsr )
+{
+    rg_free( *rsr );
+    *rsr = NULL;
+}
+
+
+int rgs_put( rgs_t rs, void* item )
+{
+    rg_size_t widx;
+
+    widx = rgs_load( rs->widx, relaxed );
+
+    if ( rgs_space( rs, widx, 1 ) > 0 ) {
+        rgs_slot_set( rs, widx, item );
+        rgs_store( rs->widx, widx + 1, release );
+        return rgs_true;
+    } else
+        return rgs_false;
+}
+
+
+void* rgs_get( rgs_t rs )
+{
+    rg_size_t ridx;
+    void*     item;
+
+    ridx = rgs_load( rs->ridx, relaxed );
+
+    if ( rgs_avail( rs, ridx, 1 ) > 0 ) {
+        item = rgs_nth( rs, ridx );
+        rgs_store( rs->ridx, ridx + 1, release );
+        return item;
+    } else
+        return NULL;
+}
+
+
+rg_size_t rgs_put_n( rgs_t rs, void** items, rg_size_t n )
+{
+    rg_size_t widx;
+    rg_size_t pos;
+    rg_size_t len;
+    rg_size_t i;
+
+    widx = rgs_load( rs->widx, relaxed );
+
+    len = rgs_space( rs, widx, n );
+    if ( n > len )
+        n = len;
+    if ( n == 0 )
+        return 0;
+
+    /*
+     * Slots are copied as two runs with relaxed stores, which are
+     * plain stores, but atomic for rgs_snapshot(). One release fence
+     * orders the Read Index seen by producer before the overwrites.
+     */
+    atomic_thread_fence( memory_order_release );
+
+    pos = widx & rs->mask;
+    len = rs->size - pos;
+    if ( len > n )
+        len = n;
+    for ( i = 0; i < len; i++ )
+        rgs_slot_fill( rs, pos + i, items[ i ] );
+    for ( ; i < n; i++ )
+        rgs_slot_fill( rs, i - len, items[ i ] );
+
+    rgs_store( rs->widx, widx + n, release );
+
+    return n;
+}
+
+
+rg_size_t rgs_get_n( rgs_t rs, void** items, rg_size_t n )
+{
+    rg_size_t ridx;
+    rg_size_t pos;
+    rg_size_t len;
+
+    ridx = rgs_load( rs->ridx, relaxed );
+
+    len = rgs_avail( rs, ridx, n );
+    if ( n > len )
+        n = len;
+    if ( n == 0 )
+        return 0;
+
+    pos = ridx & rs->mask;
+    len = rs->size - pos;
+    if ( len > n )
+        len = n;
+    memcpy( items, &rs->data[ pos ], len * rgs_unit_size );
+    memcpy( &items[ len ], &rs->data[ 0 ], ( n - len ) * rgs_unit_size );
+
+    rgs_store( rs->ridx, ridx + n, release );
+
+    return n;
+}
+
+
+rg_size_t rgs_snapshot( rgs_t rs, void** out, rg_size_t max )
+{
+    rg_size_t ridx;
+    rg_size_t widx;
+    rg_size_t next;
+    rg_size_t n;
+    rg_size_t pos;
+
+    next = rgs_load( rs->ridx, acquire );
+
+    for ( int retry = 0;; retry++ ) {
+
+        ridx = next;
+        widx = rgs_load( rs->widx, acquire );
+
+        /* Indices are read separately, hence clamp. */
+        n = widx - ridx;
+        if ( n > rs->size )
+            n = rs->size;
+        if ( n > max )
+            n = max;
+
+        /* Producer may overwrite slots during copy. */
+        for ( pos = 0; pos < n; pos++ )
+            out[ pos ] = rgs_slot_get( rs, ridx + pos );
+
+        /* Copy is ordered before the check (seqlock read). */
+        atomic_thread_fence( memory_order_acquire );
+        next = rgs_load( rs->ridx, relaxed );
+
+        if ( next == ridx )
+            return n;
+
+        if ( retry + 1 >= RGS_SNAPSHOT_RETRY ) {
+
+            /* Items before the new Read Index may be overwritten. */
+            if ( next - ridx >= n )
+                return 0;
+            memmove( out, &out[ next - ridx ], ( n - ( next - ridx ) ) * rgs_unit_size );
+            return n - ( next - ridx );
+        }
+    }
+}
+
+
+void* rgs_peek( rgs_t rs )
+{
+    rg_size_t ridx;
+
+    ridx = rgs_load( rs->ridx, relaxed );
+
+    if ( rgs_avail( rs, ridx, 1 ) > 0 )
+        return rgs_nth( rs, ridx );
+    else
+        return NULL;
+}
+
+
+rg_size_t rgs_count( rgs_t rs )
+{
+    rg_size_t ridx;
+    rg_size_t widx;
+
+    ridx = rgs_load( rs->ridx, acquire );
+    widx = rgs_load( rs->widx, acquire );
+
+    /* Indices are read separately, hence clamp. */
+    if ( widx - ridx > rs->size )
+        return rs->size;
+    else
+        return widx - ridx;
+}
+
+
+int rgs_is_empty( rgs_t rs )
+{
+    return rgs_count( rs ) == 0;
+}
+
+
+int rgs_is_full( rgs_t rs )
+{
+    return rgs_count( rs ) >= rs->size;
+}
+
+
+rg_size_t rgs_size( rgs_t rs )
+{
+    return rs->size;
+}
+
+
+
+
+/* ------------------------------------------------------------
+ * Internal functions:
+ */
+
+
+/**
+ * Return free space for producer.
+ *
+ * Read Index is loaded from shared data only when the cached value
+ * does not show enough free space.
+ */
+static rg_size_t rgs_space( rgs_t rs, rg_size_t widx, rg_size_t need )
+{
+    if ( rs->size - ( widx - rs->rcache ) < need )
+        rs->rcache = rgs_load( rs->ridx, acquire );
+
+    return rs->size - ( widx - rs->rcache );
+}
+
+
+/**
+ * Return available items for consumer.
+ *
+ * Write Index is loaded from shared data only when the cached value
+ * does not show enough available items.
+ */
+static rg_size_t rgs_avail( rgs_t rs, rg_size_t ridx, rg_size_t need )
+{
+    if ( rs->wcache - ridx < need )
+        rs->wcache = rgs_load( rs->widx, acquire );
+
+    return rs->wcache - ridx;
+}
@@ -0,0 +1,199 @@
+#ifndef RINGER_SPSC_H
+#define RINGER_SPSC_H
+
+/**
+ * @file   ringer_spsc.h
+ * @author agent <agent@local>
+ * @date   Sun Oct 18 14:30:47 2026
+ *
+ * @brief  Single producer single consumer Ringer.
+ *
+ * SPSC Ringer can be shared by one producer thread and one consumer
+ * thread without locking. Read and Write Indices are free running
+ * counters, and they are written only by the consumer and the
+ * producer, respectively. Hence there is no item count.
+ *
+ */
+
+#include <stdatomic.h>
+#include "ringer.h"
+
+
+/** Cache line size for separating producer and consumer data. */
+#define RG_CACHE_LINE 64
+
+/** Snapshot attempts before a partial snapshot is returned. */
+#define RGS_SNAPSHOT_RETRY 8
+
+
+/**
+ * SPSC Ringer struct.
+ */
+struct rgs_struct_s
+{
+    _Atomic rg_size_t widx;   /**< Write index (producer). */
+    rg_size_t         rcache; /**< Read index seen by producer. */
+    /** @cond ringer_none */
+    char pad0[ RG_CACHE_LINE - 2 * sizeof( rg_size_t ) ];
+    /** @endcond ringer_none */
+    _Atomic rg_size_t ridx;   /**< Read index (consumer). */
+    rg_size_t         wcache; /**< Write index seen by consumer. */
+    /** @cond ringer_none */
+    char pad1[ RG_CACHE_LINE - 2 * sizeof( rg_size_t ) ];
+    /** @endcond ringer_none */
+    rg_size_t size;      /**< Reservation size for data. */
+    rg_size_t mask;      /**< Index mask. */
+    void*     data[ 0 ]; /**< Pointer array. */
+};
+typedef struct rgs_struct_s rgs_s; /**< SPSC Ringer struct. */
+typedef rgs_s*              rgs_t; /**< SPSC Ringer pointer. */
+typedef rgs_t*              rgs_p; /**< SPSC Ringer pointer reference. */
+
+
+
+/* ------------------------------------------------------------
+ * SPSC Ringer:
+ */
+
+
+/**
+ * Create SPSC Ringer with size.
+ *
+ * Size is rounded up to power of two.
+ *
+ * @param size Size.
+ *
+ * @return SPSC Ringer.
+ */
+rgs_t rgs_new( rg_size_t size );
+
+
+/**
+ * Destroy SPSC Ringer.
+ *
+ * @param rsr SPSC Ringer reference.
+ */
+void rgs_destroy( rgs_p rsr );
+
+
+/**
+ * Put item to SPSC Ringer (producer).
+ *
+ * @param rs   SPSC Ringer.
+ * @param item Item.
+ *
+ * @return 1 on success (0 if full).
+ */
+int rgs_put( rgs_t rs, void* item );
+
+
+/**
+ * Get item from SPSC Ringer (consumer).
+ *
+ * @param rs SPSC Ringer.
+ *
+ * @return Item (or NULL if empty).
+ */
+void* rgs_get( rgs_t rs );
+
+
+/**
+ * Put items to SPSC Ringer (producer).
+ *
+ * Items are put as many as fit, and they are published together.
+ *
+ * @param rs    SPSC Ringer.
+ * @param items Item array.
+ * @param n     Item count.
+ *
+ * @return Number of items put.
+ */
+rg_size_t rgs_put_n( rgs_t rs, void** items, rg_size_t n );
+
+
+/**
+ * Get items from SPSC Ringer (consumer).
+ *
+ * @param rs    SPSC Ringer.
+ * @param items Item array.
+ * @param n     Maximum item count.
+ *
+ * @return Number of items got.
+ */
+rg_size_t rgs_get_n( rgs_t rs, void** items, rg_size_t n );
+
+
+/**
+ * Copy items of SPSC Ringer to array (any thread).
+ *
+ * Snapshot is taken while the producer and the consumer run, and it
+ * does not block them. Read Index is checked after the copy, and the
+ * copy is retried if the consumer has advanced, since the producer
+ * may have overwritten the copied slots. After RGS_SNAPSHOT_RETRY
+ * attempts, the copied items that are still valid are returned, i.e.
+ * the oldest items may be missing.
+ *
+ * @param rs  SPSC Ringer.
+ * @param out Item array.
+ * @param max Maximum item count.
+ *
+ * @return Number of items copied.
+ */
+rg_size_t rgs_snapshot( rgs_t rs, void** out, rg_size_t max );
+
+
+/**
+ * Peek item from SPSC Ringer (consumer).
+ *
+ * No changes to Ringer state.
+ *
+ * @param rs SPSC Ringer.
+ *
+ * @return Item (or NULL if empty).
+ */
+void* rgs_peek( rgs_t rs );
+
+
+/**
+ * Return item count of SPSC Ringer.
+ *
+ * Count is exact only for the producer and the consumer.
+ *
+ * @param rs SPSC Ringer.
+ *
+ * @return Count.
+ */
+rg_size_t rgs_count( rgs_t rs );
+
+
+/**
+ * Is SPSC Ringer empty?
+ *
+ * @param rs SPSC Ringer.
+ *
+ * @return 1 if empty.
+ */
+int rgs_is_empty( rgs_t rs );
+
+
+/**
+ * Is SPSC Ringer full?
+ *
+ * @param rs SPSC Ringer.
+ *
+ * @return 1 if full.
+ */
+int rgs_is_full( rgs_t rs );
+
+
+/**
+ * Return SPSC Ringer storage size.
+ *
+ * @param rs SPSC Ringer.
+ *
+ * @return Size.
+ */
+rg_size_t rgs_size( rgs_t rs );
+
+
+#endif
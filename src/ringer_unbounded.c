@@ -0,0 +1,528 @@
+/**
+ * @file   ringer_unbounded.c
+ * @author agent <agent@local>
+ * @date   Sun Oct 18 14:35:45 2026
+ *
+ * @brief  Unbounded lock free Ringer.
+ *
+ */
+
+#include "ringer_unbounded.h"
+
+
+/* clang-format off */
+
+/** @cond ringer_none */
+#define rgu_true      1
+#define rgu_false     0
+#define rgu_closed    ( (rg_size_t)1 << 63 )
+#define rgu_seg_size(size) ( sizeof(rgu_seg_s) + size*sizeof(rgu_cell_s) )
+#define rgu_load( var )         atomic_load_explicit( &( var ), memory_order_acquire )
+#define rgu_store( var, val )   atomic_store_explicit( &( var ), ( val ), memory_order_release )
+#define rgu_cas( var, exp, val ) \
+    atomic_compare_exchange_weak_explicit( &( var ), ( exp ), ( val ), memory_order_acq_rel, memory_order_acquire )
+/** @endcond ringer_none */
+
+/* clang-format on */
+
+
+/**
+ * Segment cell.
+ *
+ * Sequence number tells whether cell is free (position) or full
+ * (position + 1) for the position that maps to the cell.
+ */
+struct rgu_cell_s
+{
+    _Atomic rg_size_t seq;  /**< Sequence number. */
+    void*             item; /**< Item. */
+};
+typedef struct rgu_cell_s rgu_cell_s;
+
+
+/**
+ * Segment.
+ *
+ * Bounded lock free ring with closed flag in enqueue position.
+ */
+struct rgu_seg_s
+{
+    _Atomic rg_size_t epos; /**< Enqueue position (and closed flag). */
+    /** @cond ringer_none */
+    char pad0[ RGU_CACHE_LINE - sizeof( rg_size_t ) ];
+    /** @endcond ringer_none */
+    _Atomic rg_size_t dpos; /**< Dequeue position. */
+    /** @cond ringer_none */
+    char pad1[ RGU_CACHE_LINE - sizeof( rg_size_t ) ];
+    /** @endcond ringer_none */
+    rgu_seg_s* _Atomic next;    /**< Next segment. */
+    rgu_seg_s*         retired; /**< Next retired segment. */
+    rg_size_t          size;    /**< Size. */
+    rg_size_t          mask;    /**< Index mask. */
+    rgu_cell_s         cell[ 0 ]; /**< Cells. */
+};
+
+
+/**
+ * Thread record.
+ *
+ * Thread announces the epoch it observed, and whether it is in
+ * operation. Record is written only by the owning thread, and it is
+ * reused by another thread after owner exits.
+ */
+struct rgu_thread_s
+{
+    _Atomic rg_size_t epoch;  /**< Observed epoch. */
+    _Atomic int       active; /**< Thread is in operation. */
+    _Atomic int       used;   /**< Record is owned by a thread. */
+    rgu_thread_s*     next;   /**< Next record. */
+    /** @cond ringer_none */
+    char pad[ RGU_CACHE_LINE - sizeof( rg_size_t ) - 2 * sizeof( int ) - sizeof( void* ) ];
+    /** @endcond ringer_none */
+};
+
+
+static rgu_seg_s* rgu_seg_new( rg_size_t size );
+static int rgu_seg_put( rgu_seg_s* seg, void* item );
+static int rgu_seg_get( rgu_seg_s* seg, void** item );
+static rgu_thread_s* rgu_thread( rgu_t ru );
+static void rgu_exit( void* arg );
+static rgu_thread_s* rgu_pin( rgu_t ru );
+static void rgu_unpin( rgu_thread_s* self );
+static void rgu_retire( rgu_t ru, rgu_seg_s* seg );
+static void rgu_reclaim( rgu_t ru );
+static void rgu_free_list( rgu_seg_s* seg );
+
+
+
+/* ------------------------------------------------------------
+ * Unbounded Ringer:
+ */
+
+
+rgu_t rgu_new( rg_size_t size )
+{
+    rgu_t      ru;
+    rgu_seg_s* seg;
+
+    ru = (rgu_t)rg_malloc( sizeof( rgu_s ) );
+
+    if ( pthread_key_create( &ru->key, rgu_exit ) != 0 ) {
+        rg_free( ru );
+        return NULL;
+    }
+
+    seg = rgu_seg_new( size );
+
+    atomic_init( &ru->head, seg );
+    atomic_init( &ru->tail, seg );
+    atomic_init( &ru->epoch, 0 );
+    atomic_init( &ru->pending, 0 );
+    atomic_init( &ru->threads, NULL );
+
+    for ( int i = 0; i < 3; i++ )
+        atomic_init( &ru->slot[ i ].retired, NULL );
+
+    return ru;
+}
+
+
+void rgu_destroy( rgu_p rur )
+{
+    rgu_t         ru = *rur;
+    rgu_seg_s*    seg;
+    rgu_seg_s*    next;
+    rgu_thread_s* rec;
+    rgu_thread_s* rec_next;
+
+    pthread_key_delete( ru->key );
+
+    rec = atomic_load( &ru->threads );
+    while ( rec ) {
+        rec_next = rec->next;
+        rg_free( rec );
+        rec = rec_next;
+    }
+
+    seg = atomic_load( &ru->head );
+    while ( seg ) {
+        next = atomic_load( &seg->next );
+        rg_free( seg );
+        seg = next;
+    }
+
+    for ( int i = 0; i < 3; i++ )
+        rgu_free_list( atomic_load( &ru->slot[ i ].retired ) );
+
+    rg_free( ru );
+    *rur = NULL;
+}
+
+
+int rgu_put( rgu_t ru, void* item )
+{
+    rgu_thread_s* self;
+    rgu_seg_s*    seg;
+    rgu_seg_s*    next;
+    rgu_seg_s*    grow;
+    int           ret;
+
+    self = rgu_pin( ru );
+    ret = rgu_false;
+
+    for ( ;; ) {
+
+        seg = rgu_load( ru->tail );
+
+        if ( rgu_seg_put( seg, item ) )
+            break;
+
+        /* Segment is closed, continue in next segment. */
+        next = rgu_load( seg->next );
+
+        if ( next == NULL ) {
+
+            /* Link larger segment with the item already in it. */
+            grow = rgu_seg_new( seg->size * 2 );
+            grow->cell[ 0 ].item = item;
+            atomic_store_explicit( &grow->cell[ 0 ].seq, 1, memory_order_relaxed );
+            atomic_store_explicit( &grow->epos, 1, memory_order_relaxed );
+
+            if ( rgu_cas( seg->next, &next, grow ) ) {
+                rgu_cas( ru->tail, &seg, grow );
+                ret = rgu_true;
+                break;
+            }
+
+            rg_free( grow );
+
+        } else {
+
+            rgu_cas( ru->tail, &seg, next );
+        }
+    }
+
+    rgu_unpin( self );
+
+    return ret;
+}
+
+
+void* rgu_get( rgu_t ru )
+{
+    rgu_thread_s* self;
+    rgu_seg_s*    seg;
+    rgu_seg_s*    next;
+    rgu_seg_s*    tail;
+    void*         item;
+
+    self = rgu_pin( ru );
+    item = NULL;
+
+    for ( ;; ) {
+
+        seg = rgu_load( ru->head );
+
+        if ( rgu_seg_get( seg, &item ) >= 0 )
+            break;
+
+        /* Segment is closed and empty. */
+        next = rgu_load( seg->next );
+        if ( next == NULL )
+            break;
+
+        /* Tail must not refer to retired segment. */
+        tail = seg;
+        rgu_cas( ru->tail, &tail, next );
+
+        if ( rgu_cas( ru->head, &seg, next ) )
+            rgu_retire( ru, seg );
+    }
+
+    if ( atomic_load_explicit( &ru->pending, memory_order_relaxed ) )
+        rgu_reclaim( ru );
+
+    rgu_unpin( self );
+
+    return item;
+}
+
+
+rg_size_t rgu_size( rgu_t ru )
+{
+    rgu_thread_s* self;
+    rg_size_t     size;
+
+    self = rgu_pin( ru );
+    size = rgu_load( ru->tail )->size;
+    rgu_unpin( self );
+
+    return size;
+}
+
+
+
+
+/* ------------------------------------------------------------
+ * Internal functions:
+ */
+
+
+static rgu_seg_s* rgu_seg_new( rg_size_t size )
+{
+    rgu_seg_s* seg;
+    rg_size_t  pow;
+
+    pow = RG_MIN_SIZE;
+    while ( pow < size )
+        pow <<= 1;
+
+    seg = (rgu_seg_s*)rg_malloc( rgu_seg_size( pow ) );
+
+    atomic_init( &seg->epos, 0 );
+    atomic_init( &seg->dpos, 0 );
+    atomic_init( &seg->next, NULL );
+    seg->retired = NULL;
+    seg->size = pow;
+    seg->mask = pow - 1;
+
+    for ( rg_size_t i = 0; i < pow; i++ ) {
+        atomic_init( &seg->cell[ i ].seq, i );
+        seg->cell[ i ].item = NULL;
+    }
+
+    return seg;
+}
+
+
+/**
+ * Put item to segment.
+ *
+ * Segment is closed when it is full.
+ *
+ * @return 1 on success (0 if closed).
+ */
+static int rgu_seg_put( rgu_seg_s* seg, void* item )
+{
+    rgu_cell_s* cell;
+    rg_size_t   pos;
+    int64_t     dif;
+
+    pos = rgu_load( seg->epos );
+
+    for ( ;; ) {
+
+        if ( pos & rgu_closed )
+            return rgu_false;
+
+        cell = &seg->cell[ pos & seg->mask ];
+        dif = (int64_t)( rgu_load( cell->seq ) - pos );
+
+        if ( dif == 0 ) {
+            if ( rgu_cas( seg->epos, &pos, pos + 1 ) ) {
+                cell->item = item;
+                rgu_store( cell->seq, pos + 1 );
+                return rgu_true;
+            }
+        } else if ( dif < 0 ) {
+            atomic_fetch_or( &seg->epos, rgu_closed );
+            return rgu_false;
+        } else {
+            pos = rgu_load( seg->epos );
+        }
+    }
+}
+
+
+/**
+ * Get item from segment.
+ *
+ * @return 1 if item was got, 0 if empty, and -1 if closed and empty.
+ */
+static int rgu_seg_get( rgu_seg_s* seg, void** item )
+{
+    rgu_cell_s* cell;
+    rg_size_t   pos;
+    rg_size_t   epos;
+    int64_t     dif;
+
+    pos = rgu_load( seg->dpos );
+
+    for ( ;; ) {
+
+        cell = &seg->cell[ pos & seg->mask ];
+        dif = (int64_t)( rgu_load( cell->seq ) - ( pos + 1 ) );
+
+        if ( dif == 0 ) {
+            if ( rgu_cas( seg->dpos, &pos, pos + 1 ) ) {
+                *item = cell->item;
+                rgu_store( cell->seq, pos + seg->size );
+                return 1;
+            }
+        } else if ( dif < 0 ) {
+            epos = rgu_load( seg->epos );
+            if ( !( epos & rgu_closed ) )
+                return 0;
+            if ( pos >= ( epos & ~rgu_closed ) )
+                return -1;
+            /* Item put before close is being written. */
+            pos = rgu_load( seg->dpos );
+        } else {
+            pos = rgu_load( seg->dpos );
+        }
+    }
+}
+
+
+/**
+ * Return thread record, register at first call.
+ *
+ * Record released by exited thread is reused, otherwise a new record
+ * is linked to the list.
+ */
+static rgu_thread_s* rgu_thread( rgu_t ru )
+{
+    rgu_thread_s* self;
+    int           used;
+
+    self = (rgu_thread_s*)pthread_getspecific( ru->key );
+
+    if ( self == NULL ) {
+
+        for ( self = rgu_load( ru->threads ); self; self = self->next ) {
+            used = 0;
+            if ( atomic_load_explicit( &self->used, memory_order_relaxed ) == 0
+                 && atomic_compare_exchange_strong( &self->used, &used, 1 ) )
+                break;
+        }
+
+        if ( self == NULL ) {
+            self = (rgu_thread_s*)rg_malloc( sizeof( rgu_thread_s ) );
+            atomic_init( &self->epoch, 0 );
+            atomic_init( &self->active, 0 );
+            atomic_init( &self->used, 1 );
+            self->next = atomic_load_explicit( &ru->threads, memory_order_relaxed );
+            while ( !rgu_cas( ru->threads, &self->next, self ) )
+                ;
+        }
+
+        pthread_setspecific( ru->key, self );
+    }
+
+    return self;
+}
+
+
+/**
+ * Release thread record at thread exit.
+ */
+static void rgu_exit( void* arg )
+{
+    rgu_thread_s* self = arg;
+
+    rgu_store( self->used, 0 );
+}
+
+
+/**
+ * Enter epoch.
+ *
+ * Thread announces the epoch it observed in its own record, and the
+ * epoch is confirmed after the announcement is visible. Stores go to
+ * the cache line of the thread, no shared line is written.
+ */
+static rgu_thread_s* rgu_pin( rgu_t ru )
+{
+    rgu_thread_s* self;
+    rg_size_t     epoch;
+    rg_size_t     now;
+
+    self = rgu_thread( ru );
+
+    epoch = atomic_load_explicit( &ru->epoch, memory_order_relaxed );
+    atomic_store_explicit( &self->epoch, epoch, memory_order_relaxed );
+    rgu_store( self->active, 1 );
+
+    for ( ;; ) {
+        atomic_thread_fence( memory_order_seq_cst );
+        now = rgu_load( ru->epoch );
+        if ( now == epoch )
+            return self;
+        epoch = now;
+        rgu_store( self->epoch, epoch );
+    }
+}
+
+
+static void rgu_unpin( rgu_thread_s* self )
+{
+    rgu_store( self->active, 0 );
+}
+
+
+/**
+ * Retire segment that is no longer reachable.
+ *
+ * Segment is tagged with the current epoch, and it is freed when the
+ * epoch has advanced twice.
+ */
+static void rgu_retire( rgu_t ru, rgu_seg_s* seg )
+{
+    rgu_epoch_s* slot;
+
+    slot = &ru->slot[ atomic_load( &ru->epoch ) % 3 ];
+
+    seg->retired = atomic_load( &slot->retired );
+    while ( !atomic_compare_exchange_weak( &slot->retired, &seg->retired, seg ) )
+        ;
+
+    atomic_fetch_add( &ru->pending, 1 );
+}
+
+
+/**
+ * Advance epoch, if all active threads have observed the current
+ * epoch, and free segments retired two epochs ago.
+ *
+ * Caller must be active, which prevents the epoch from advancing
+ * further while retired segments are taken.
+ */
+static void rgu_reclaim( rgu_t ru )
+{
+    rg_size_t     epoch;
+    rgu_seg_s*    seg;
+    rg_size_t     cnt;
+    rgu_thread_s* rec;
+
+    epoch = atomic_load( &ru->epoch );
+
+    for ( rec = rgu_load( ru->threads ); rec; rec = rec->next ) {
+        if ( rgu_load( rec->active ) && rgu_load( rec->epoch ) != epoch )
+            return;
+    }
+
+    if ( !atomic_compare_exchange_strong( &ru->epoch, &epoch, epoch + 1 ) )
+        return;
+
+    seg = atomic_exchange( &ru->slot[ ( epoch + 2 ) % 3 ].retired, NULL );
+
+    cnt = 0;
+    for ( rgu_seg_s* s = seg; s; s = s->retired )
+        cnt++;
+    if ( cnt )
+        atomic_fetch_sub( &ru->pending, cnt );
+
+    rgu_free_list( seg );
+}
+
+
+static void rgu_free_list( rgu_seg_s* seg )
+{
+    rgu_seg_s* next;
+
+    while ( seg ) {
+        next = seg->retired;
+        rg_free( seg );
+        seg = next;
+    }
+}
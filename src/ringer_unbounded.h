@@ -0,0 +1,142 @@
+#ifndef RINGER_UNBOUNDED_H
+#define RINGER_UNBOUNDED_H
+
+/**
+ * @file   ringer_unbounded.h
+ * @author agent <agent@local>
+ * @date   Sun Oct 18 14:35:45 2026
+ *
+ * @brief  Unbounded lock free Ringer.
+ *
+ * Unbounded Ringer is a multi producer multi consumer queue, which
+ * grows when full. Storage is a list of segments, each being a
+ * bounded lock free ring. When the last segment becomes full, it is
+ * closed and a segment of double size is linked after it. Consumers
+ * continue to the next segment after the closed segment is empty.
+ *
+ * Unbounded Ringer is not relocated when it grows, hence it is
+ * shared between threads without locks. Segments are released with
+ * epoch based reclamation, i.e. segment is freed after all threads
+ * that might refer to it have completed their operations. Each thread
+ * announces its epoch in a record of its own, hence operations do not
+ * write to shared cache lines for reclamation.
+ *
+ */
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include "ringer.h"
+
+
+/** Cache line size for separating shared data. */
+#define RGU_CACHE_LINE 64
+
+
+typedef struct rgu_seg_s    rgu_seg_s;    /**< Segment struct (opaque). */
+typedef struct rgu_thread_s rgu_thread_s; /**< Thread record struct (opaque). */
+
+
+/**
+ * Epoch slot.
+ */
+struct rgu_epoch_s
+{
+    rgu_seg_s* _Atomic retired; /**< Segments retired in epoch. */
+    /** @cond ringer_none */
+    char pad[ RGU_CACHE_LINE - sizeof( void* ) ];
+    /** @endcond ringer_none */
+};
+typedef struct rgu_epoch_s rgu_epoch_s; /**< Epoch slot struct. */
+
+
+/**
+ * Unbounded Ringer struct.
+ */
+struct rgu_struct_s
+{
+    rgu_seg_s* _Atomic head; /**< Segment for consumers. */
+    /** @cond ringer_none */
+    char pad0[ RGU_CACHE_LINE - sizeof( void* ) ];
+    /** @endcond ringer_none */
+    rgu_seg_s* _Atomic tail; /**< Segment for producers. */
+    /** @cond ringer_none */
+    char pad1[ RGU_CACHE_LINE - sizeof( void* ) ];
+    /** @endcond ringer_none */
+    _Atomic rg_size_t     epoch;   /**< Global epoch. */
+    _Atomic rg_size_t     pending; /**< Retired segments not freed. */
+    rgu_thread_s* _Atomic threads; /**< Thread records. */
+    pthread_key_t         key;     /**< Thread record key. */
+    /** @cond ringer_none */
+    char pad2[ RGU_CACHE_LINE - 3 * sizeof( rg_size_t ) - sizeof( pthread_key_t ) ];
+    /** @endcond ringer_none */
+    rgu_epoch_s slot[ 3 ]; /**< Epoch slots. */
+};
+typedef struct rgu_struct_s rgu_s; /**< Unbounded Ringer struct. */
+typedef rgu_s*              rgu_t; /**< Unbounded Ringer pointer. */
+typedef rgu_t*              rgu_p; /**< Unbounded Ringer pointer reference. */
+
+
+
+/* ------------------------------------------------------------
+ * Unbounded Ringer:
+ */
+
+
+/**
+ * Create Unbounded Ringer.
+ *
+ * Size is rounded up to power of two.
+ *
+ * @param size Initial size.
+ *
+ * @return Unbounded Ringer (or NULL if thread key can't be created).
+ */
+rgu_t rgu_new( rg_size_t size );
+
+
+/**
+ * Destroy Unbounded Ringer.
+ *
+ * Producers and consumers must be stopped.
+ *
+ * @param rur Unbounded Ringer reference.
+ */
+void rgu_destroy( rgu_p rur );
+
+
+/**
+ * Put item to Unbounded Ringer.
+ *
+ * Put always succeeds, and Ringer grows when full.
+ *
+ * @param ru   Unbounded Ringer.
+ * @param item Item.
+ *
+ * @return 1 if Ringer was grown (else 0).
+ */
+int rgu_put( rgu_t ru, void* item );
+
+
+/**
+ * Get item from Unbounded Ringer.
+ *
+ * @param ru Unbounded Ringer.
+ *
+ * @return Item (or NULL if empty).
+ */
+void* rgu_get( rgu_t ru );
+
+
+/**
+ * Return Unbounded Ringer storage size.
+ *
+ * Size of the segment used by producers.
+ *
+ * @param ru Unbounded Ringer.
+ *
+ * @return Size.
+ */
+rg_size_t rgu_size( rgu_t ru );
+
+
+#endif
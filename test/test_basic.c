@@ -393,3 +393,281 @@ void test_random( void )
             break;
     }
 }
+
+
+struct mark_log_s
+{
+    int high;
+    int low;
+    int cnt;
+};
+
+
+void mark_callback( rg_t rg, int high, void* ctx )
+{
+    struct mark_log_s* log = ctx;
+
+    if ( high )
+        log->high++;
+    else
+        log->low++;
+    log->cnt = rg_count( rg );
+}
+
+
+void test_marks( void )
+{
+    rg_t rg;
+    int  items[ 8 ];
+    struct mark_log_s log = { 0, 0, 0 };
+
+    rg = rg_new( 4 );
+
+    TEST_ASSERT_EQUAL( 0, rg_set_marks( rg, 3, 3, mark_callback, &log ) );
+    TEST_ASSERT_EQUAL( 1, rg_set_marks( rg, 1, 3, mark_callback, &log ) );
+
+    rg_put( rg, &items[ 0 ] );
+    rg_put_front( rg, &items[ 1 ] );
+    TEST_ASSERT_EQUAL( 0, log.high );
+
+    rg_put( rg, &items[ 2 ] );
+    TEST_ASSERT_EQUAL( 1, log.high );
+    TEST_ASSERT_EQUAL( 3, log.cnt );
+
+    /* Once per crossing. */
+    rg_put( rg, &items[ 3 ] );
+    rg_get( rg );
+    rg_put( rg, &items[ 4 ] );
+    TEST_ASSERT_EQUAL( 1, log.high );
+    TEST_ASSERT_EQUAL( 0, log.low );
+
+    rg_ram( &rg, &items[ 5 ] );
+    rg_get_back( rg );
+    rg_get_nth( rg, 1 );
+    rg_get( rg );
+    TEST_ASSERT_EQUAL( 0, log.low );
+    rg_get( rg );
+    TEST_ASSERT_EQUAL( 1, log.low );
+    TEST_ASSERT_EQUAL( 1, log.cnt );
+
+    rg_get( rg );
+    rg_put( rg, &items[ 6 ] );
+    TEST_ASSERT_EQUAL( 1, log.high );
+    TEST_ASSERT_EQUAL( 1, log.low );
+
+    rg_clear_marks( rg );
+    TEST_ASSERT_NULL( ( (void**)rg )[ -1 ] ); /* Extension slot. */
+    for ( int i = 0; i < 4; i++ )
+        rg_put( rg, &items[ 7 ] );
+    TEST_ASSERT_EQUAL( 1, log.high );
+
+    rg_destroy( &rg );
+}
+
+
+void test_splice( void )
+{
+    rg_t rg1;
+    rg_t rg2;
+    rg_t keep;
+    int  items[ 32 ];
+    int* item;
+    struct mark_log_s log = { 0, 0, 0 };
+
+    for ( int i = 0; i < 32; i++ )
+        items[ i ] = i;
+
+    rg1 = rg_new( 5 );
+    rg2 = rg_new( 6 );
+
+    /* Wrap both Ringers. */
+    for ( int i = 0; i < 4; i++ ) {
+        rg_put( rg1, &items[ 0 ] );
+        rg_put( rg2, &items[ 0 ] );
+    }
+    for ( int i = 0; i < 4; i++ ) {
+        rg_get( rg1 );
+        rg_get( rg2 );
+    }
+
+    rg_put( rg1, &items[ 0 ] );
+    rg_put( rg1, &items[ 1 ] );
+    for ( int i = 10; i < 16; i++ )
+        rg_put( rg2, &items[ i ] );
+
+    /* Limited by space of rg1. */
+    TEST_ASSERT_EQUAL( 3, rg_splice( rg1, rg2, 4 ) );
+    TEST_ASSERT_EQUAL( 1, rg_is_full( rg1 ) );
+    TEST_ASSERT_EQUAL( 3, rg_count( rg2 ) );
+    TEST_ASSERT_EQUAL( 0, rg_splice( rg1, rg2, 4 ) );
+
+    TEST_ASSERT_EQUAL( 3, rg_splice_front( rg2, rg1, 3 ) );
+    TEST_ASSERT_EQUAL( 2, rg_count( rg1 ) );
+    TEST_ASSERT_EQUAL( 6, rg_count( rg2 ) );
+
+    /* rg1: 0 1, rg2: 10 11 12 13 14 15 */
+    int expect[] = { 10, 11, 12, 13, 14, 15 };
+    for ( int i = 0; i < 6; i++ ) {
+        item = rg_get_nth( rg2, 0 );
+        TEST_ASSERT_EQUAL( expect[ i ], *item );
+        rg_put( rg2, item );
+    }
+
+    /* Concat with resize. */
+    TEST_ASSERT_EQUAL( 1, rg_concat( &rg1, &rg2 ) );
+    TEST_ASSERT_EQUAL( 10, rg_size( rg1 ) );
+    TEST_ASSERT_EQUAL( 8, rg_count( rg1 ) );
+    TEST_ASSERT_EQUAL( 1, rg_is_empty( rg2 ) );
+
+    int expect2[] = { 0, 1, 10, 11, 12, 13, 14, 15 };
+    for ( int i = 0; i < 8; i++ ) {
+        item = rg_get( rg1 );
+        TEST_ASSERT_EQUAL( expect2[ i ], *item );
+        rg_ram( &rg2, item );
+    }
+
+    /* Concat to empty swaps, watermarks stay. */
+    rg_set_marks( rg1, 0, 4, mark_callback, &log );
+    keep = rg2;
+    TEST_ASSERT_EQUAL( 0, rg_concat( &rg1, &rg2 ) );
+    TEST_ASSERT_EQUAL_PTR( keep, rg1 );
+    TEST_ASSERT_EQUAL( 1, log.high );
+    TEST_ASSERT_EQUAL( 8, log.cnt );
+    TEST_ASSERT_NULL( ( (void**)rg2 )[ -1 ] ); /* Extension slot. */
+    TEST_ASSERT_EQUAL( 8, rg_count( rg1 ) );
+
+    for ( int i = 0; i < 8; i++ ) {
+        item = rg_get( rg1 );
+        TEST_ASSERT_EQUAL( expect2[ i ], *item );
+    }
+    TEST_ASSERT_EQUAL( 1, log.low );
+
+    rg_destroy( &rg1 );
+    rg_destroy( &rg2 );
+}
+
+
+void test_init( void )
+{
+    void* buf[ 16 ];
+    int   items[ 16 ];
+    rg_t  rg;
+    int*  item;
+
+    TEST_ASSERT_NULL( rg_init( buf, RG_BYTES( 1 ) ) );
+
+    rg = rg_init( buf, RG_BYTES( 8 ) );
+    TEST_ASSERT_EQUAL_PTR( &buf[ 1 ], rg );
+    TEST_ASSERT_EQUAL( 8, rg_size( rg ) );
+    TEST_ASSERT_EQUAL( 1, rg_is_empty( rg ) );
+
+    /* Partial item slot is not used. */
+    rg = rg_init( buf, RG_BYTES( 8 ) + sizeof( void* ) - 1 );
+    TEST_ASSERT_EQUAL( 8, rg_size( rg ) );
+
+    for ( int i = 0; i < 12; i++ ) {
+        items[ i ] = i;
+        TEST_ASSERT_EQUAL( i < 8, rg_put( rg, &items[ i ] ) );
+    }
+    TEST_ASSERT_EQUAL( 1, rg_is_full( rg ) );
+
+    for ( int i = 0; i < 4; i++ ) {
+        item = rg_get( rg );
+        TEST_ASSERT_EQUAL( i, *item );
+    }
+
+    /* Wrap over the end of storage. */
+    for ( int i = 8; i < 12; i++ )
+        TEST_ASSERT_EQUAL( 1, rg_put( rg, &items[ i ] ) );
+
+    for ( int i = 4; i < 12; i++ ) {
+        item = rg_get( rg );
+        TEST_ASSERT_EQUAL( i, *item );
+    }
+    TEST_ASSERT_NULL( rg_get( rg ) );
+}
+
+
+static void drain_callback( void* item, void* ctx )
+{
+    rg_t log = ctx;
+    rg_put( log, item );
+}
+
+
+void test_drain( void )
+{
+    rg_t rg;
+    rg_t log;
+    int  items[ 40 ];
+    int* item;
+
+    for ( int i = 0; i < 40; i++ )
+        items[ i ] = i;
+
+    rg = rg_new( 32 );
+    log = rg_new( 64 );
+
+    TEST_ASSERT_EQUAL( 0, rg_drain( rg, drain_callback, log, 0 ) );
+
+    /* Data wraps over the end of storage. */
+    for ( int i = 0; i < 20; i++ )
+        rg_put( rg, &items[ i ] );
+    for ( int i = 0; i < 20; i++ )
+        rg_get( rg );
+    for ( int i = 0; i < 30; i++ )
+        rg_put( rg, &items[ i ] );
+
+    TEST_ASSERT_EQUAL( 5, rg_drain( rg, drain_callback, log, 5 ) );
+    TEST_ASSERT_EQUAL( 25, rg_count( rg ) );
+    TEST_ASSERT_EQUAL( 25, rg_drain( rg, drain_callback, log, 0 ) );
+    TEST_ASSERT_EQUAL( 1, rg_is_empty( rg ) );
+
+    TEST_ASSERT_EQUAL( 30, rg_count( log ) );
+    for ( int i = 0; i < 30; i++ ) {
+        item = rg_get( log );
+        TEST_ASSERT_EQUAL( i, *item );
+    }
+
+    /* Fewer items than prefetch distance. */
+    rg_put( rg, &items[ 0 ] );
+    rg_put( rg, &items[ 1 ] );
+    TEST_ASSERT_EQUAL( 2, rg_drain( rg, drain_callback, log, 100 ) );
+    TEST_ASSERT_EQUAL( 2, rg_count( log ) );
+
+    rg_destroy( &rg );
+    rg_destroy( &log );
+}
+
+
+void test_snapshot( void )
+{
+    rg_t  rg;
+    int   items[ 20 ];
+    void* out[ 20 ];
+
+    for ( int i = 0; i < 20; i++ )
+        items[ i ] = i;
+
+    rg = rg_new( 8 );
+    TEST_ASSERT_EQUAL( 0, rg_snapshot( rg, out, 20 ) );
+
+    /* Data wraps over the end of storage. */
+    for ( int i = 0; i < 6; i++ )
+        rg_put( rg, &items[ i ] );
+    for ( int i = 0; i < 6; i++ )
+        rg_get( rg );
+    for ( int i = 0; i < 7; i++ )
+        rg_put( rg, &items[ i ] );
+
+    TEST_ASSERT_EQUAL( 7, rg_snapshot( rg, out, 20 ) );
+    for ( int i = 0; i < 7; i++ )
+        TEST_ASSERT_EQUAL_PTR( &items[ i ], out[ i ] );
+    TEST_ASSERT_EQUAL( 7, rg_count( rg ) );
+
+    TEST_ASSERT_EQUAL( 3, rg_snapshot( rg, out, 3 ) );
+    for ( int i = 0; i < 3; i++ )
+        TEST_ASSERT_EQUAL_PTR( &items[ i ], out[ i ] );
+
+    rg_destroy( &rg );
+}
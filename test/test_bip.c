@@ -0,0 +1,171 @@
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include "unity.h"
+#include "ringer_bip.h"
+
+
+void test_bip_records( void )
+{
+    rgb_t     rb;
+    char*     p;
+    rg_size_t len;
+
+    rb = rgb_new( 16 );
+    TEST_ASSERT_EQUAL( 16, rgb_size( rb ) );
+    TEST_ASSERT_EQUAL( 1, rgb_is_empty( rb ) );
+    TEST_ASSERT_NULL( rgb_peek( rb, &len ) );
+    TEST_ASSERT_EQUAL( 0, len );
+
+    /* Commit shorter than reservation. */
+    p = rgb_reserve( rb, 8 );
+    memcpy( p, "abcdef", 6 );
+    rgb_commit( rb, 6 );
+
+    p = rgb_reserve( rb, 6 );
+    memcpy( p, "ghijkl", 6 );
+    rgb_commit( rb, 6 );
+    TEST_ASSERT_EQUAL( 12, rgb_count( rb ) );
+
+    /* Not contiguous space for 6 bytes. */
+    TEST_ASSERT_NULL( rgb_reserve( rb, 6 ) );
+
+    p = rgb_peek( rb, &len );
+    TEST_ASSERT_EQUAL( 12, len );
+    TEST_ASSERT_EQUAL( 0, memcmp( p, "abcdefghijkl", 12 ) );
+    rgb_consume( rb, 6 );
+
+    /* Wrap over to region B. */
+    p = rgb_reserve( rb, 6 );
+    TEST_ASSERT_EQUAL_PTR( rb->data, p );
+    memcpy( p, "mnopqr", 6 );
+    rgb_commit( rb, 6 );
+    TEST_ASSERT_EQUAL( 12, rgb_count( rb ) );
+
+    /* Region B can't reach region A. */
+    TEST_ASSERT_NULL( rgb_reserve( rb, 1 ) );
+
+    p = rgb_peek( rb, &len );
+    TEST_ASSERT_EQUAL( 6, len );
+    TEST_ASSERT_EQUAL( 0, memcmp( p, "ghijkl", 6 ) );
+    rgb_consume( rb, 6 );
+
+    p = rgb_peek( rb, &len );
+    TEST_ASSERT_EQUAL( 6, len );
+    TEST_ASSERT_EQUAL( 0, memcmp( p, "mnopqr", 6 ) );
+    rgb_consume( rb, 6 );
+
+    TEST_ASSERT_EQUAL( 1, rgb_is_empty( rb ) );
+    TEST_ASSERT_NOT_NULL( rgb_reserve( rb, 16 ) );
+    rgb_commit( rb, 0 );
+    TEST_ASSERT_EQUAL( 1, rgb_is_empty( rb ) );
+
+    rgb_destroy( &rb );
+    TEST_ASSERT_NULL( rb );
+}
+
+
+void test_bip_consume_reserved( void )
+{
+    rgb_t     rb;
+    char*     p;
+    rg_size_t len;
+
+    rb = rgb_new( 32 );
+
+    p = rgb_reserve( rb, 10 );
+    memcpy( p, "0123456789", 10 );
+    rgb_commit( rb, 10 );
+
+    /* Reservation after region A, consume all, then commit. */
+    p = rgb_reserve( rb, 15 );
+    TEST_ASSERT_EQUAL_PTR( &rb->data[ 10 ], p );
+    rgb_consume( rb, 10 );
+    memcpy( p, "abcdefghijklmno", 15 );
+    rgb_commit( rb, 15 );
+
+    TEST_ASSERT_EQUAL( 15, rgb_count( rb ) );
+    TEST_ASSERT_EQUAL( 0, rgb_is_empty( rb ) );
+    p = rgb_peek( rb, &len );
+    TEST_ASSERT_EQUAL( 15, len );
+    TEST_ASSERT_EQUAL( 0, memcmp( p, "abcdefghijklmno", 15 ) );
+
+    /* Next reservation wraps to region B. */
+    p = rgb_reserve( rb, 8 );
+    TEST_ASSERT_EQUAL_PTR( rb->data, p );
+    memcpy( p, "pqrstuvw", 8 );
+    rgb_commit( rb, 8 );
+    TEST_ASSERT_EQUAL( 23, rgb_count( rb ) );
+    TEST_ASSERT_NULL( rgb_reserve( rb, 3 ) );
+
+    rgb_consume( rb, 15 );
+    p = rgb_peek( rb, &len );
+    TEST_ASSERT_EQUAL( 8, len );
+    TEST_ASSERT_EQUAL( 0, memcmp( p, "pqrstuvw", 8 ) );
+    rgb_consume( rb, 8 );
+    TEST_ASSERT_EQUAL( 1, rgb_is_empty( rb ) );
+
+    rgb_destroy( &rb );
+}
+
+
+void test_bip_readv_writev( void )
+{
+    rgb_t     rb;
+    int       in[ 2 ];
+    int       out[ 2 ];
+    char      buf[ 32 ];
+    char*     p;
+    rg_size_t len;
+
+    TEST_ASSERT_EQUAL( 0, pipe( in ) );
+    TEST_ASSERT_EQUAL( 0, pipe( out ) );
+
+    rb = rgb_new( 16 );
+
+    /* Leave free space on both sides of data. */
+    p = rgb_reserve( rb, 10 );
+    memcpy( p, "0123456789", 10 );
+    rgb_commit( rb, 10 );
+    rgb_consume( rb, 4 );
+
+    /* Read fills the end and continues from the start. */
+    TEST_ASSERT_EQUAL( 8, write( in[ 1 ], "abcdefgh", 8 ) );
+    TEST_ASSERT_EQUAL( 8, rgb_readv( rb, in[ 0 ] ) );
+    TEST_ASSERT_EQUAL( 14, rgb_count( rb ) );
+
+    p = rgb_peek( rb, &len );
+    TEST_ASSERT_EQUAL( 12, len );
+    TEST_ASSERT_EQUAL( 0, memcmp( p, "456789abcdef", 12 ) );
+
+    /* Remaining space is before region A. */
+    TEST_ASSERT_EQUAL( 4, write( in[ 1 ], "ijkl", 4 ) );
+    TEST_ASSERT_EQUAL( 2, rgb_readv( rb, in[ 0 ] ) );
+    TEST_ASSERT_EQUAL( 16, rgb_count( rb ) );
+
+    errno = 0;
+    TEST_ASSERT_EQUAL( -1, rgb_readv( rb, in[ 0 ] ) );
+    TEST_ASSERT_EQUAL( ENOBUFS, errno );
+
+    /* Write drains both regions. */
+    TEST_ASSERT_EQUAL( 16, rgb_writev( rb, out[ 1 ] ) );
+    TEST_ASSERT_EQUAL( 1, rgb_is_empty( rb ) );
+    TEST_ASSERT_EQUAL( 0, rgb_writev( rb, out[ 1 ] ) );
+
+    TEST_ASSERT_EQUAL( 16, read( out[ 0 ], buf, sizeof( buf ) ) );
+    TEST_ASSERT_EQUAL( 0, memcmp( buf, "456789abcdefghij", 16 ) );
+
+    TEST_ASSERT_EQUAL( 2, rgb_readv( rb, in[ 0 ] ) );
+    p = rgb_peek( rb, &len );
+    TEST_ASSERT_EQUAL( 2, len );
+    TEST_ASSERT_EQUAL( 0, memcmp( p, "kl", 2 ) );
+
+    /* End of file. */
+    close( in[ 1 ] );
+    TEST_ASSERT_EQUAL( 0, rgb_readv( rb, in[ 0 ] ) );
+
+    close( in[ 0 ] );
+    close( out[ 0 ] );
+    close( out[ 1 ] );
+    rgb_destroy( &rb );
+}
@@ -0,0 +1,177 @@
+#include "unity.h"
+#include "ringer.h"
+#include "ringer_chan.h"
+
+
+/* Resume by counting. */
+void count_resume( rgch_wait_t w )
+{
+    ( *( (int*)w->ctx ) )++;
+}
+
+
+/* Executor collecting waiters. */
+struct exec_s
+{
+    rgch_wait_t ready[ 8 ];
+    int         cnt;
+};
+
+
+void collect_exec( rgch_wait_t w, void* ctx )
+{
+    struct exec_s* exec = ctx;
+    exec->ready[ exec->cnt++ ] = w;
+}
+
+
+void test_chan_basics( void )
+{
+    rgch_t      ch;
+    rgch_wait_s w1;
+    rgch_wait_s w2;
+    int         items[ 8 ];
+    void*       item;
+    int         resumed = 0;
+
+    for ( int i = 0; i < 8; i++ )
+        items[ i ] = i;
+
+    w1.resume = count_resume;
+    w1.ctx = &resumed;
+    w2.resume = count_resume;
+    w2.ctx = &resumed;
+
+    ch = rgch_new( 2 );
+
+    /* Popper waits, and gets item directly. */
+    TEST_ASSERT_EQUAL( RGCH_WAIT, rgch_pop( ch, &item, NULL ) );
+    TEST_ASSERT_EQUAL( RGCH_WAIT, rgch_pop( ch, &item, &w1 ) );
+    TEST_ASSERT_EQUAL( RGCH_DONE, rgch_push( ch, &items[ 0 ], NULL ) );
+    TEST_ASSERT_EQUAL( 1, resumed );
+    TEST_ASSERT_EQUAL( RGCH_DONE, w1.status );
+    TEST_ASSERT_EQUAL_PTR( &items[ 0 ], w1.item );
+    TEST_ASSERT_EQUAL( 0, rgch_count( ch ) );
+
+    /* Pusher waits, and popper stores its item. */
+    rgch_push( ch, &items[ 1 ], NULL );
+    rgch_push( ch, &items[ 2 ], NULL );
+    TEST_ASSERT_EQUAL( RGCH_WAIT, rgch_push( ch, &items[ 3 ], NULL ) );
+    TEST_ASSERT_EQUAL( RGCH_WAIT, rgch_push( ch, &items[ 3 ], &w2 ) );
+    TEST_ASSERT_EQUAL( RGCH_DONE, rgch_pop( ch, &item, NULL ) );
+    TEST_ASSERT_EQUAL_PTR( &items[ 1 ], item );
+    TEST_ASSERT_EQUAL( 2, resumed );
+    TEST_ASSERT_EQUAL( RGCH_DONE, w2.status );
+    TEST_ASSERT_EQUAL( 2, rgch_count( ch ) );
+
+    rgch_pop( ch, &item, NULL );
+    TEST_ASSERT_EQUAL_PTR( &items[ 2 ], item );
+    rgch_pop( ch, &item, NULL );
+    TEST_ASSERT_EQUAL_PTR( &items[ 3 ], item );
+
+    rgch_destroy( &ch );
+    TEST_ASSERT_NULL( ch );
+}
+
+
+void test_chan_exec( void )
+{
+    rgch_t        ch;
+    rgch_wait_s   w[ 3 ];
+    int           items[ 3 ];
+    void*         item;
+    int           resumed = 0;
+    struct exec_s exec;
+
+    exec.cnt = 0;
+
+    ch = rgch_new( 2 );
+    rgch_set_executor( ch, collect_exec, &exec );
+
+    for ( int i = 0; i < 3; i++ ) {
+        w[ i ].resume = count_resume;
+        w[ i ].ctx = &resumed;
+        TEST_ASSERT_EQUAL( RGCH_WAIT, rgch_pop( ch, &item, &w[ i ] ) );
+    }
+
+    for ( int i = 0; i < 3; i++ )
+        rgch_push( ch, &items[ i ], NULL );
+
+    /* Executor resumes in batch. */
+    TEST_ASSERT_EQUAL( 0, resumed );
+    TEST_ASSERT_EQUAL( 3, exec.cnt );
+    for ( int i = 0; i < exec.cnt; i++ ) {
+        TEST_ASSERT_EQUAL_PTR( &w[ i ], exec.ready[ i ] );
+        TEST_ASSERT_EQUAL_PTR( &items[ i ], exec.ready[ i ]->item );
+        rgch_resume( exec.ready[ i ] );
+    }
+    TEST_ASSERT_EQUAL( 3, resumed );
+
+    rgch_destroy( &ch );
+}
+
+
+void test_chan_close( void )
+{
+    rgch_t      ch;
+    rgch_wait_s w;
+    int         items[ 3 ];
+    void*       item;
+    int         resumed = 0;
+
+    w.resume = count_resume;
+    w.ctx = &resumed;
+
+    ch = rgch_new( 2 );
+
+    rgch_push( ch, &items[ 0 ], NULL );
+    rgch_push( ch, &items[ 1 ], NULL );
+    TEST_ASSERT_EQUAL( RGCH_WAIT, rgch_push( ch, &items[ 2 ], &w ) );
+
+    rgch_close( ch );
+    TEST_ASSERT_EQUAL( 1, resumed );
+    TEST_ASSERT_EQUAL( RGCH_CLOSED, w.status );
+    TEST_ASSERT_EQUAL( RGCH_CLOSED, rgch_push( ch, &items[ 2 ], NULL ) );
+
+    TEST_ASSERT_EQUAL( RGCH_DONE, rgch_pop( ch, &item, NULL ) );
+    TEST_ASSERT_EQUAL( RGCH_DONE, rgch_pop( ch, &item, NULL ) );
+    TEST_ASSERT_EQUAL( RGCH_CLOSED, rgch_pop( ch, &item, &w ) );
+
+    rgch_destroy( &ch );
+}
+
+
+void test_chan_handover( void )
+{
+    rgch_t      ch;
+    rgch_wait_s w;
+    int         items[ 2 ];
+    void*       item;
+    int         resumed = 0;
+
+    w.resume = count_resume;
+    w.ctx = &resumed;
+
+    ch = rgch_new( 0 );
+
+    /* Pusher waits, and popper takes item directly. */
+    TEST_ASSERT_EQUAL( RGCH_WAIT, rgch_push( ch, &items[ 0 ], NULL ) );
+    TEST_ASSERT_EQUAL( RGCH_WAIT, rgch_push( ch, &items[ 0 ], &w ) );
+    TEST_ASSERT_EQUAL( RGCH_DONE, rgch_pop( ch, &item, NULL ) );
+    TEST_ASSERT_EQUAL_PTR( &items[ 0 ], item );
+    TEST_ASSERT_EQUAL( 1, resumed );
+    TEST_ASSERT_EQUAL( RGCH_DONE, w.status );
+    TEST_ASSERT_EQUAL( 0, rgch_count( ch ) );
+
+    /* Popper waits, and pusher gives item directly. */
+    TEST_ASSERT_EQUAL( RGCH_WAIT, rgch_pop( ch, &item, &w ) );
+    TEST_ASSERT_EQUAL( RGCH_DONE, rgch_push( ch, &items[ 1 ], NULL ) );
+    TEST_ASSERT_EQUAL( 2, resumed );
+    TEST_ASSERT_EQUAL_PTR( &items[ 1 ], w.item );
+    TEST_ASSERT_EQUAL( 0, rgch_count( ch ) );
+
+    rgch_close( ch );
+    TEST_ASSERT_EQUAL( RGCH_CLOSED, rgch_pop( ch, &item, NULL ) );
+
+    rgch_destroy( &ch );
+}
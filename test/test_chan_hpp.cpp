@@ -0,0 +1,178 @@
+/**
+ * @file   test_chan_hpp.cpp
+ * @author agent <agent@local>
+ * @date   Sun Oct 18 15:13:48 2026
+ *
+ * @brief  Tests for C++20 coroutine interface of Channel.
+ *
+ * Unity is from Ceedling (UNITY_SRC is its src directory). Build and
+ * run:
+ *
+ *     shell> gcc -c -Isrc -I$UNITY_SRC src/ringer.c src/ringer_chan.c $UNITY_SRC/unity.c
+ *     shell> g++ -std=c++20 -Isrc -I$UNITY_SRC test/test_chan_hpp.cpp ringer.o ringer_chan.o unity.o
+ *     shell> ./a.out
+ *
+ */
+
+#include <coroutine>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+#include "unity.h"
+#include "ringer_chan.hpp"
+
+
+#define CHAN_STAGES 1000
+
+
+/* Eagerly started coroutine, frame is released at completion. */
+struct task
+{
+    struct promise_type
+    {
+        task get_return_object() { return {}; }
+        std::suspend_never initial_suspend() { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() { std::abort(); }
+    };
+};
+
+
+static task producer( ringer::channel<int>& ch, int* items, int n, int* pushed )
+{
+    for ( int i = 0; i < n; i++ )
+        if ( co_await ch.push( &items[ i ] ) )
+            ( *pushed )++;
+}
+
+
+static task consumer( ringer::channel<int>& ch, int* sum, int* done )
+{
+    while ( int* item = co_await ch.pop() )
+        *sum += *item;
+    *done = 1;
+}
+
+
+static task stage( ringer::channel<int>& in, ringer::channel<int>& out )
+{
+    while ( int* item = co_await in.pop() )
+        co_await out.push( item );
+    out.close();
+}
+
+
+/* Stack position of caller (coroutine locals are in frame). */
+__attribute__( ( noinline ) ) static uintptr_t stack_pos( void )
+{
+    return (uintptr_t)__builtin_frame_address( 0 );
+}
+
+
+static task sink( ringer::channel<int>& in, uintptr_t* low, int* sum )
+{
+    while ( int* item = co_await in.pop() ) {
+        if ( stack_pos() < *low )
+            *low = stack_pos();
+        *sum += *item;
+    }
+}
+
+
+void setUp( void ) {}
+void tearDown( void ) {}
+
+
+void test_chan_hpp_suspend( void )
+{
+    int items[ 100 ];
+    int sum = 0;
+    int done = 0;
+    int pushed = 0;
+
+    for ( int i = 0; i < 100; i++ )
+        items[ i ] = i;
+
+    ringer::channel<int> ch( 4 );
+
+    /* Consumer suspends on empty, producer on full. */
+    consumer( ch, &sum, &done );
+    producer( ch, items, 100, &pushed );
+    TEST_ASSERT_EQUAL( 100, pushed );
+    TEST_ASSERT_EQUAL( 99 * 100 / 2, sum );
+    TEST_ASSERT_EQUAL( 0, done );
+    TEST_ASSERT_EQUAL( 0, ch.count() );
+
+    ch.close();
+    TEST_ASSERT_EQUAL( 1, done );
+}
+
+
+void test_chan_hpp_close( void )
+{
+    int items[ 8 ];
+    int pushed = 0;
+    int sum = 0;
+    int done = 0;
+
+    for ( int i = 0; i < 8; i++ )
+        items[ i ] = 1;
+
+    ringer::channel<int> ch( 2 );
+
+    /* Waiting pusher is resumed with failure. */
+    producer( ch, items, 8, &pushed );
+    TEST_ASSERT_EQUAL( 2, pushed );
+    ch.close();
+    TEST_ASSERT_EQUAL( 2, pushed );
+
+    /* Stored items are popped after close. */
+    consumer( ch, &sum, &done );
+    TEST_ASSERT_EQUAL( 2, sum );
+    TEST_ASSERT_EQUAL( 1, done );
+
+    /* Push to closed Channel fails without suspending. */
+    producer( ch, items, 8, &pushed );
+    TEST_ASSERT_EQUAL( 2, pushed );
+}
+
+
+void test_chan_hpp_stack( void )
+{
+    std::vector<std::unique_ptr<ringer::channel<int>>> chs;
+    int                                                 items[ 3 ] = { 1, 2, 3 };
+    int                                                 pushed = 0;
+    int                                                 sum = 0;
+    uintptr_t                                           base = stack_pos();
+    uintptr_t                                           low = base;
+
+    /* Handover through a chain of stages, without storage. */
+    for ( int i = 0; i <= CHAN_STAGES; i++ )
+        chs.push_back( std::make_unique<ringer::channel<int>>( 0 ) );
+
+    sink( *chs[ CHAN_STAGES ], &low, &sum );
+    for ( int i = CHAN_STAGES - 1; i >= 0; i-- )
+        stage( *chs[ i ], *chs[ i + 1 ] );
+
+    producer( *chs[ 0 ], items, 3, &pushed );
+    chs[ 0 ]->close();
+
+    TEST_ASSERT_EQUAL( 3, pushed );
+    TEST_ASSERT_EQUAL( 6, sum );
+
+    /* Resumes are not nested stage by stage, at any optimization level. */
+    TEST_ASSERT( base - low < 64 * 1024 );
+}
+
+
+int main( void )
+{
+    UNITY_BEGIN();
+    RUN_TEST( test_chan_hpp_suspend );
+    RUN_TEST( test_chan_hpp_close );
+    RUN_TEST( test_chan_hpp_stack );
+    return UNITY_END();
+}
@@ -0,0 +1,86 @@
+#include <stdint.h>
+#include "unity.h"
+#include "ringer_compact.h"
+
+
+void test_compact_basics( void )
+{
+    rgc_t rc;
+    int   items[ 16 ];
+    int*  item;
+
+    for ( int i = 0; i < 16; i++ )
+        items[ i ] = i;
+
+    TEST_ASSERT_EQUAL( 16, sizeof( rgc_s ) );
+    TEST_ASSERT_NULL( rgc_new( RGC_MAX_SIZE + 1 ) );
+    TEST_ASSERT_NULL( rgc_new( UINT32_MAX ) );
+
+    rc = rgc_new( 5 );
+    TEST_ASSERT_EQUAL( 8, rgc_size( rc ) );
+    TEST_ASSERT_EQUAL( 1, rgc_is_empty( rc ) );
+    TEST_ASSERT_EQUAL( 0, rgc_is_full( rc ) );
+    TEST_ASSERT_NULL( rgc_get( rc ) );
+    TEST_ASSERT_NULL( rgc_peek( rc ) );
+
+    for ( int i = 0; i < 8; i++ )
+        TEST_ASSERT_EQUAL( 1, rgc_put( rc, &items[ i ] ) );
+
+    TEST_ASSERT_EQUAL( 1, rgc_is_full( rc ) );
+    TEST_ASSERT_EQUAL( 8, rgc_count( rc ) );
+    TEST_ASSERT_EQUAL( 0, rgc_put( rc, &items[ 8 ] ) );
+
+    for ( int i = 0; i < 5; i++ ) {
+        item = rgc_peek( rc );
+        TEST_ASSERT_EQUAL( i, *item );
+        item = rgc_get( rc );
+        TEST_ASSERT_EQUAL( i, *item );
+    }
+
+    for ( int i = 8; i < 13; i++ )
+        TEST_ASSERT_EQUAL( 1, rgc_put( rc, &items[ i ] ) );
+
+    for ( int i = 5; i < 13; i++ ) {
+        item = rgc_get( rc );
+        TEST_ASSERT_EQUAL( i, *item );
+    }
+    TEST_ASSERT_EQUAL( 1, rgc_is_empty( rc ) );
+
+    rgc_destroy( &rc );
+    TEST_ASSERT_NULL( rc );
+}
+
+
+void test_compact_wrap( void )
+{
+    void* buf[ 16 ];
+    int   items[ 16 ];
+    rgc_t rc;
+    int*  item;
+
+    TEST_ASSERT_NULL( rgc_init( buf, RGC_BYTES( 1 ) ) );
+
+    /* Rounded down to power of two. */
+    rc = rgc_init( buf, RGC_BYTES( 6 ) );
+    TEST_ASSERT_EQUAL_PTR( buf, rc );
+    TEST_ASSERT_EQUAL( 4, rgc_size( rc ) );
+
+    /* Counters wrap around at 32 bits. */
+    rc->ridx = UINT32_MAX - 2;
+    rc->widx = UINT32_MAX - 2;
+
+    for ( int i = 0; i < 16; i++ ) {
+        items[ i ] = i;
+        if ( rgc_is_full( rc ) )
+            TEST_ASSERT_EQUAL( i - 4, *(int*)rgc_get( rc ) );
+        TEST_ASSERT_EQUAL( 1, rgc_put( rc, &items[ i ] ) );
+        TEST_ASSERT_EQUAL( i < 4 ? i + 1 : 4, rgc_count( rc ) );
+    }
+
+    for ( int i = 12; i < 16; i++ ) {
+        item = rgc_get( rc );
+        TEST_ASSERT_EQUAL( i, *item );
+    }
+    TEST_ASSERT_EQUAL( 1, rgc_is_empty( rc ) );
+    TEST_ASSERT_EQUAL( 0, rgc_count( rc ) );
+}
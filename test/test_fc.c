@@ -0,0 +1,135 @@
+#include <limits.h>
+#include <pthread.h>
+#include "unity.h"
+#include "ringer.h"
+#include "ringer_fc.h"
+
+
+#define FC_THREADS 4
+#define FC_ITEMS   20000
+
+
+void test_fc_api( void )
+{
+    rgfc_t fc;
+    int    items[ 8 ];
+    int*   item;
+
+    for ( int i = 0; i < 8; i++ )
+        items[ i ] = i;
+
+    fc = rgfc_new( 4, 0 );
+    TEST_ASSERT_EQUAL( 4, rgfc_size( fc ) );
+    TEST_ASSERT_EQUAL( 1, rgfc_is_empty( fc ) );
+    TEST_ASSERT_NULL( rgfc_get( fc ) );
+    TEST_ASSERT_NULL( rgfc_peek( fc ) );
+
+    TEST_ASSERT_EQUAL( 1, rgfc_put( fc, &items[ 1 ] ) );
+    TEST_ASSERT_EQUAL( 1, rgfc_put( fc, &items[ 2 ] ) );
+    TEST_ASSERT_EQUAL( 1, rgfc_put_front( fc, &items[ 0 ] ) );
+    TEST_ASSERT_EQUAL( 1, rgfc_put( fc, &items[ 3 ] ) );
+    TEST_ASSERT_EQUAL( 1, rgfc_is_full( fc ) );
+    TEST_ASSERT_EQUAL( 0, rgfc_put( fc, &items[ 4 ] ) );
+
+    /* Ram resizes. */
+    TEST_ASSERT_EQUAL( 1, rgfc_ram( fc, &items[ 4 ] ) );
+    TEST_ASSERT_EQUAL( 8, rgfc_size( fc ) );
+    TEST_ASSERT_EQUAL( 5, rgfc_count( fc ) );
+
+    item = rgfc_peek( fc );
+    TEST_ASSERT_EQUAL( 0, *item );
+    item = rgfc_peek_back( fc );
+    TEST_ASSERT_EQUAL( 4, *item );
+    item = rgfc_get_back( fc );
+    TEST_ASSERT_EQUAL( 4, *item );
+    item = rgfc_get_nth( fc, 2 );
+    TEST_ASSERT_EQUAL( 2, *item );
+    item = rgfc_get_nth( fc, -1 );
+    TEST_ASSERT_EQUAL( 3, *item );
+
+    TEST_ASSERT_EQUAL( 0, rgfc_resize( fc, 1 ) );
+    TEST_ASSERT_EQUAL( 1, rgfc_resize( fc, 2 ) );
+    TEST_ASSERT_EQUAL( 2, rgfc_size( fc ) );
+
+    item = rgfc_get( fc );
+    TEST_ASSERT_EQUAL( 0, *item );
+    item = rgfc_get( fc );
+    TEST_ASSERT_EQUAL( 1, *item );
+    TEST_ASSERT_EQUAL( 1, rgfc_is_empty( fc ) );
+
+    rgfc_destroy( &fc );
+    TEST_ASSERT_NULL( fc );
+}
+
+
+static rgfc_t fc_shared;
+static int    fc_items[ FC_THREADS ][ FC_ITEMS ];
+
+
+static void* fc_worker( void* arg )
+{
+    int* base = arg;
+    long sum = 0;
+    int* item;
+
+    /* Mixed deque operations, every put is followed by a get. */
+    for ( int i = 0; i < FC_ITEMS; i++ ) {
+        if ( i % 2 || !rgfc_put_front( fc_shared, &base[ i ] ) )
+            rgfc_ram( fc_shared, &base[ i ] );
+        do {
+            item = ( i % 3 ) ? rgfc_get( fc_shared ) : rgfc_get_back( fc_shared );
+        } while ( item == NULL );
+        sum += *item;
+    }
+
+    return (void*)sum;
+}
+
+
+void test_fc_threads( void )
+{
+    pthread_t thr[ FC_THREADS ];
+    void*     ret;
+    long      sum = 0;
+    long      exp = 0;
+
+    /* Fewer slots than threads, exercises direct apply. */
+    fc_shared = rgfc_new( 16, FC_THREADS - 1 );
+
+    for ( int t = 0; t < FC_THREADS; t++ ) {
+        for ( int i = 0; i < FC_ITEMS; i++ ) {
+            fc_items[ t ][ i ] = t * FC_ITEMS + i;
+            exp += t * FC_ITEMS + i;
+        }
+    }
+
+    for ( int t = 0; t < FC_THREADS; t++ )
+        pthread_create( &thr[ t ], NULL, fc_worker, fc_items[ t ] );
+
+    for ( int t = 0; t < FC_THREADS; t++ ) {
+        pthread_join( thr[ t ], &ret );
+        sum += (long)ret;
+    }
+
+    TEST_ASSERT_EQUAL( exp, sum );
+    TEST_ASSERT_EQUAL( 1, rgfc_is_empty( fc_shared ) );
+
+    rgfc_destroy( &fc_shared );
+}
+
+
+void test_fc_no_key( void )
+{
+    pthread_key_t keys[ PTHREAD_KEYS_MAX ];
+    int           cnt = 0;
+    rgfc_t fc;
+
+    /* Creation fails cleanly when thread keys are exhausted. */
+    while ( cnt < PTHREAD_KEYS_MAX && pthread_key_create( &keys[ cnt ], NULL ) == 0 )
+        cnt++;
+    fc = rgfc_new( 4, 0 );
+    while ( cnt > 0 )
+        pthread_key_delete( keys[ --cnt ] );
+
+    TEST_ASSERT_NULL( fc );
+}
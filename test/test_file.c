@@ -0,0 +1,199 @@
+#include <stdio.h>
+#include <unistd.h>
+#include "unity.h"
+#include "ringer_file.h"
+
+
+#define TEST_FILE "test_ringer_file.dat"
+#define TEST_COPY "test_ringer_file.bak"
+
+
+/* Copy file contents, i.e. the state that a crash would leave. */
+void copy_file( const char* from, const char* to )
+{
+    FILE* fi;
+    FILE* fo;
+    char  buf[ 4096 ];
+    size_t n;
+
+    fi = fopen( from, "rb" );
+    fo = fopen( to, "wb" );
+    while ( ( n = fread( buf, 1, sizeof( buf ), fi ) ) > 0 )
+        fwrite( buf, 1, n, fo );
+    fclose( fi );
+    fclose( fo );
+}
+
+
+/* Overwrite byte at offset. */
+void poke_file( const char* path, long offset, char byte )
+{
+    FILE* fp;
+
+    fp = fopen( path, "r+b" );
+    fseek( fp, offset, SEEK_SET );
+    fwrite( &byte, 1, 1, fp );
+    fclose( fp );
+}
+
+
+void setUp( void )
+{
+    unlink( TEST_FILE );
+    unlink( TEST_COPY );
+}
+
+
+void tearDown( void )
+{
+    unlink( TEST_FILE );
+    unlink( TEST_COPY );
+}
+
+
+void test_file_basics( void )
+{
+    rgf_t rf;
+    int   limit;
+    int   rec[ 2 ];
+
+    limit = 10;
+
+    rf = rgf_open( TEST_FILE, limit, sizeof( rec ) );
+    TEST_ASSERT_NOT_NULL( rf );
+    TEST_ASSERT_EQUAL( limit, rgf_size( rf ) );
+    TEST_ASSERT_EQUAL( 1, rgf_is_empty( rf ) );
+
+    for ( int i = 0; i < limit; i++ ) {
+        rec[ 0 ] = i;
+        rec[ 1 ] = -i;
+        TEST_ASSERT_EQUAL( 1, rgf_put( rf, rec ) );
+    }
+
+    TEST_ASSERT_EQUAL( 1, rgf_is_full( rf ) );
+    TEST_ASSERT_EQUAL( 0, rgf_put( rf, rec ) );
+
+    for ( int i = 0; i < limit / 2; i++ ) {
+        TEST_ASSERT_EQUAL( i, ( (const int*)rgf_peek( rf ) )[ 0 ] );
+        TEST_ASSERT_EQUAL( 1, rgf_get( rf, rec ) );
+        TEST_ASSERT_EQUAL( i, rec[ 0 ] );
+        TEST_ASSERT_EQUAL( -i, rec[ 1 ] );
+    }
+
+    /* Released space is available after sync. */
+    TEST_ASSERT_EQUAL( 1, rgf_is_full( rf ) );
+    TEST_ASSERT_EQUAL( 1, rgf_sync( rf ) );
+    TEST_ASSERT_EQUAL( 0, rgf_is_full( rf ) );
+
+    for ( int i = limit; i < limit + limit / 2; i++ ) {
+        rec[ 0 ] = i;
+        rec[ 1 ] = -i;
+        TEST_ASSERT_EQUAL( 1, rgf_put( rf, rec ) );
+    }
+
+    TEST_ASSERT_EQUAL( 1, rgf_close( &rf ) );
+    TEST_ASSERT_NULL( rf );
+
+    /* Recover. */
+    rf = rgf_open( TEST_FILE, 0, sizeof( rec ) );
+    TEST_ASSERT_NOT_NULL( rf );
+    TEST_ASSERT_EQUAL( limit, rgf_count( rf ) );
+
+    for ( int i = limit / 2; i < limit + limit / 2; i++ ) {
+        TEST_ASSERT_EQUAL( 1, rgf_get( rf, rec ) );
+        TEST_ASSERT_EQUAL( i, rec[ 0 ] );
+        TEST_ASSERT_EQUAL( -i, rec[ 1 ] );
+    }
+
+    TEST_ASSERT_EQUAL( 0, rgf_get( rf, rec ) );
+    TEST_ASSERT_NULL( rgf_peek( rf ) );
+
+    rgf_close( &rf );
+
+    /* Record size mismatch. */
+    rf = rgf_open( TEST_FILE, 0, sizeof( int ) );
+    TEST_ASSERT_NULL( rf );
+}
+
+
+void test_file_recover( void )
+{
+    rgf_t rf;
+    int   rec;
+
+    rf = rgf_open( TEST_FILE, 4, sizeof( rec ) );
+
+    rec = 1;
+    rgf_put( rf, &rec );
+    rgf_sync( rf );
+
+    rec = 2;
+    rgf_put( rf, &rec );
+    rgf_get( rf, NULL );
+
+    /* Unsynced changes are not visible after crash. */
+    rgf_t crash;
+    copy_file( TEST_FILE, TEST_COPY );
+    crash = rgf_open( TEST_COPY, 0, sizeof( rec ) );
+    TEST_ASSERT_EQUAL( 1, rgf_count( crash ) );
+    rgf_get( crash, &rec );
+    TEST_ASSERT_EQUAL( 1, rec );
+    rgf_close( &crash );
+
+    rgf_close( &rf );
+    rf = rgf_open( TEST_FILE, 0, sizeof( rec ) );
+    TEST_ASSERT_EQUAL( 1, rgf_count( rf ) );
+    TEST_ASSERT_EQUAL( 2, *( (const int*)rgf_peek( rf ) ) );
+
+    rec = 3;
+    rgf_put( rf, &rec );
+    rgf_sync( rf );
+
+    /* Broken latest header, recover from previous sync. */
+    copy_file( TEST_FILE, TEST_COPY );
+    poke_file( TEST_COPY, ( rf->seq % 2 ) * ( RGF_HEAD_SIZE / 2 ) + 16, 0x55 );
+    rgf_close( &rf );
+
+    rf = rgf_open( TEST_COPY, 0, sizeof( rec ) );
+    TEST_ASSERT_NOT_NULL( rf );
+    TEST_ASSERT_EQUAL( 1, rgf_count( rf ) );
+    rgf_get( rf, &rec );
+    TEST_ASSERT_EQUAL( 2, rec );
+    rgf_close( &rf );
+
+    /* Both headers broken. */
+    poke_file( TEST_COPY, 16, 0x55 );
+    poke_file( TEST_COPY, RGF_HEAD_SIZE / 2 + 16, 0x55 );
+    rf = rgf_open( TEST_COPY, 0, sizeof( rec ) );
+    TEST_ASSERT_NULL( rf );
+}
+
+
+void test_file_blank( void )
+{
+    rgf_t rf;
+    int   rec;
+    FILE* fp;
+
+    /* Too large size is rejected. */
+    TEST_ASSERT_NULL( rgf_open( TEST_FILE, (rg_size_t)-1 / 2, 4 ) );
+
+    /* Crash after create, before first header write. */
+    fp = fopen( TEST_FILE, "wb" );
+    fclose( fp );
+    TEST_ASSERT_EQUAL( 0, truncate( TEST_FILE, RGF_HEAD_SIZE + 4 * sizeof( rec ) ) );
+
+    TEST_ASSERT_NULL( rgf_open( TEST_FILE, 8, sizeof( rec ) ) );
+
+    rf = rgf_open( TEST_FILE, 4, sizeof( rec ) );
+    TEST_ASSERT_NOT_NULL( rf );
+    TEST_ASSERT_EQUAL( 0, rgf_count( rf ) );
+    rec = 5;
+    TEST_ASSERT_EQUAL( 1, rgf_put( rf, &rec ) );
+    rgf_close( &rf );
+
+    rf = rgf_open( TEST_FILE, 0, sizeof( rec ) );
+    TEST_ASSERT_NOT_NULL( rf );
+    TEST_ASSERT_EQUAL( 1, rgf_count( rf ) );
+    rgf_close( &rf );
+}
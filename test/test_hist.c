@@ -0,0 +1,200 @@
+#include <pthread.h>
+#include <time.h>
+#include "unity.h"
+#include "ringer.h"
+#include "ringer_hist.h"
+
+
+#define HIST_THREADS 4
+#define HIST_VALUES  10000
+
+
+void test_hist_basics( void )
+{
+    rgh_t h;
+    rgh_t snap;
+
+    h = rgh_new();
+    snap = rgh_new();
+
+    TEST_ASSERT_EQUAL( 0, rgh_count( h ) );
+    TEST_ASSERT_EQUAL( 0, rgh_percentile( h, 50.0 ) );
+    TEST_ASSERT_EQUAL( 0, rgh_mean( h ) );
+
+    /* Small values are exact. */
+    for ( int i = 1; i <= 10; i++ )
+        rgh_record( h, i );
+
+    TEST_ASSERT_EQUAL( 10, rgh_count( h ) );
+    TEST_ASSERT_EQUAL( 5, rgh_mean( h ) );
+    TEST_ASSERT_EQUAL( 10, rgh_max( h ) );
+    TEST_ASSERT_EQUAL( 5, rgh_percentile( h, 50.0 ) );
+    TEST_ASSERT_EQUAL( 9, rgh_percentile( h, 90.0 ) );
+    TEST_ASSERT_EQUAL( 10, rgh_percentile( h, 100.0 ) );
+    TEST_ASSERT_EQUAL( 1, rgh_percentile( h, 0.0 ) );
+
+    /* Large values within relative error. */
+    rgh_reset( h );
+    TEST_ASSERT_EQUAL( 0, rgh_count( h ) );
+
+    for ( int i = 0; i < 99; i++ )
+        rgh_record( h, 1000 );
+    rgh_record( h, 1000000 );
+
+    TEST_ASSERT( rgh_percentile( h, 50.0 ) >= 1000 );
+    TEST_ASSERT( rgh_percentile( h, 50.0 ) < 1000 + 1000 / RGH_SUB );
+    TEST_ASSERT_EQUAL( 1000000, rgh_percentile( h, 100.0 ) );
+    TEST_ASSERT_EQUAL( 1000000, rgh_max( h ) );
+
+    rgh_record( h, UINT64_MAX );
+    TEST_ASSERT_EQUAL( UINT64_MAX, rgh_max( h ) );
+
+    /* Snapshot and merge. */
+    rgh_snapshot( h, snap );
+    TEST_ASSERT_EQUAL( 101, rgh_count( snap ) );
+    rgh_merge( snap, h );
+    TEST_ASSERT_EQUAL( 202, rgh_count( snap ) );
+    TEST_ASSERT_EQUAL( UINT64_MAX, rgh_max( snap ) );
+    TEST_ASSERT_EQUAL( rgh_percentile( h, 50.0 ), rgh_percentile( snap, 50.0 ) );
+
+    rgh_destroy( &h );
+    rgh_destroy( &snap );
+    TEST_ASSERT_NULL( h );
+}
+
+
+static rgh_t hist_shared;
+
+
+static void* hist_worker( void* arg )
+{
+    (void)arg;
+    for ( int i = 0; i < HIST_VALUES; i++ )
+        rgh_record( hist_shared, i );
+    return NULL;
+}
+
+
+void test_hist_threads( void )
+{
+    pthread_t thr[ HIST_THREADS ];
+    rgh_t     total;
+
+    hist_shared = rgh_new();
+    total = rgh_new();
+
+    for ( int t = 0; t < HIST_THREADS; t++ )
+        pthread_create( &thr[ t ], NULL, hist_worker, NULL );
+
+    /* Merge while recording. */
+    rgh_merge( total, hist_shared );
+
+    for ( int t = 0; t < HIST_THREADS; t++ )
+        pthread_join( thr[ t ], NULL );
+
+    TEST_ASSERT_EQUAL( HIST_THREADS * HIST_VALUES, rgh_count( hist_shared ) );
+    TEST_ASSERT_EQUAL( HIST_VALUES - 1, rgh_max( hist_shared ) );
+
+    rgh_reset( total );
+    rgh_merge( total, hist_shared );
+    TEST_ASSERT_EQUAL( HIST_THREADS * HIST_VALUES, rgh_count( total ) );
+
+    rgh_destroy( &hist_shared );
+    rgh_destroy( &total );
+}
+
+
+struct dwell_log_s
+{
+    int       cnt;
+    rg_size_t ns[ 16 ];
+};
+
+
+static void dwell_callback( rg_t rg, rg_size_t ns, void* ctx )
+{
+    struct dwell_log_s* log = ctx;
+    (void)rg;
+    log->ns[ log->cnt++ ] = ns;
+}
+
+
+static void dwell_drain( void* item, void* ctx )
+{
+    (void)item;
+    (void)ctx;
+}
+
+
+static void dwell_sleep( void )
+{
+    struct timespec ts = { 0, 20000000 };
+    nanosleep( &ts, NULL );
+}
+
+
+void test_hist_dwell( void )
+{
+    rg_t               rg;
+    struct dwell_log_s log = { 0, { 0 } };
+    int                items[ 8 ];
+    int*               item;
+    rgh_t              h;
+
+    for ( int i = 0; i < 8; i++ )
+        items[ i ] = i;
+
+    rg = rg_new( 4 );
+    rg_set_dwell( rg, dwell_callback, &log );
+
+    /* Wrap storage, then force resize by rotation. */
+    rg_put( rg, &items[ 0 ] );
+    rg_put( rg, &items[ 0 ] );
+    rg_get( rg );
+    rg_get( rg );
+    log.cnt = 0;
+
+    rg_put( rg, &items[ 1 ] );
+    dwell_sleep();
+    rg_put( rg, &items[ 2 ] );
+    rg_put_front( rg, &items[ 0 ] );
+    dwell_sleep();
+    rg_put( rg, &items[ 3 ] );
+    TEST_ASSERT_EQUAL( 1, rg_ram( &rg, &items[ 4 ] ) );
+    TEST_ASSERT_EQUAL( 0, log.cnt );
+
+    /* Item 2 (middle), item 1 (oldest), item 4 (newest). */
+    item = rg_get_nth( rg, 2 );
+    TEST_ASSERT_EQUAL( 2, *item );
+    item = rg_get_nth( rg, 1 );
+    TEST_ASSERT_EQUAL( 1, *item );
+    item = rg_get_back( rg );
+    TEST_ASSERT_EQUAL( 4, *item );
+
+    TEST_ASSERT_EQUAL( 3, log.cnt );
+    TEST_ASSERT( log.ns[ 0 ] >= 20000000 && log.ns[ 0 ] < log.ns[ 1 ] );
+    TEST_ASSERT( log.ns[ 1 ] >= 40000000 );
+    TEST_ASSERT( log.ns[ 2 ] < 20000000 );
+
+    /* Drain reports the rest (items 0 and 3). */
+    TEST_ASSERT_EQUAL( 2, rg_drain( rg, dwell_drain, NULL, 0 ) );
+    TEST_ASSERT_EQUAL( 5, log.cnt );
+    TEST_ASSERT( log.ns[ 3 ] >= 20000000 );
+    TEST_ASSERT( log.ns[ 4 ] < log.ns[ 3 ] );
+
+    /* Histogram as callback. */
+    h = rgh_new();
+    rg_set_dwell( rg, rgh_dwell, h );
+    rg_put( rg, &items[ 0 ] );
+    rg_get( rg );
+    TEST_ASSERT_EQUAL( 1, rgh_count( h ) );
+
+    rg_clear_dwell( rg );
+    TEST_ASSERT_NULL( ( (void**)rg )[ -1 ] ); /* Extension slot. */
+    rg_put( rg, &items[ 0 ] );
+    rg_get( rg );
+    TEST_ASSERT_EQUAL( 1, rgh_count( h ) );
+
+    rgh_destroy( &h );
+    rg_destroy( &rg );
+}
@@ -0,0 +1,275 @@
+#include <fcntl.h>
+#include <limits.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "unity.h"
+#include "ringer_spsc.h"
+#include "ringer_log.h"
+
+
+#define LOG_THREADS 3
+#define LOG_LINES   2000
+
+
+static char* log_read( FILE* fh, char* buf, size_t size )
+{
+    size_t len;
+
+    rewind( fh );
+    len = fread( buf, 1, size - 1, fh );
+    buf[ len ] = 0;
+
+    return buf;
+}
+
+
+void test_log_format( void )
+{
+    rgl_t       lg;
+    FILE*       fh;
+    char        buf[ 1024 ];
+    const char* name = "ringer";
+    short       s = -3;
+    float       f = 0.25f;
+
+    fh = tmpfile();
+    TEST_ASSERT_NOT_NULL( fh );
+    lg = rgl_new( fileno( fh ), 16, RGL_BLOCK );
+    TEST_ASSERT_NOT_NULL( lg );
+
+    rgl_log( lg, "plain\n" );
+    rgl_log( lg, "%d %ld %u %x %lld\n", -1, 123456789012L, 7u, 255, -5LL );
+    rgl_log( lg, "[%s] [%8s] [%-4s] [%c] [%%]\n", name, "abc", "de", 'z' );
+    rgl_log( lg, "%.3f %5.1f %e %hd\n", 3.14159, f, 1e10, s );
+    rgl_log( lg, "%d %d %d %d %d %d %d\n", 1, 2, 3, 4, 5, 6, 7 );
+    rgl_log( lg, "%*d %q\n", 5 );
+    rgl_log( lg, "%x %u %hd %hu %hhx %lx %ld\n", -1, -2, -3, -1, -1, -1L, -1L );
+    rgl_flush( lg );
+
+    log_read( fh, buf, sizeof( buf ) );
+    TEST_ASSERT_EQUAL_STRING( "plain\n"
+                              "-1 123456789012 7 ff -5\n"
+                              "[ringer] [     abc] [de  ] [z] [%]\n"
+                              "3.142   0.2 1.000000e+10 -3\n"
+                              "1 2 3 4 5 6 7\n"
+                              "%*d %q\n"
+                              "ffffffff 4294967294 -3 65535 ff ffffffffffffffff -1\n",
+                              buf );
+
+    rgl_destroy( &lg );
+    TEST_ASSERT_NULL( lg );
+    fclose( fh );
+}
+
+
+void test_log_strings( void )
+{
+    rgl_t lg;
+    FILE* fh;
+    char  buf[ 1024 ];
+    char  name[ 16 ];
+    char  want[ 256 ];
+    char  big[ 100 ];
+
+    fh = tmpfile();
+    TEST_ASSERT_NOT_NULL( fh );
+    lg = rgl_new( fileno( fh ), 16, RGL_BLOCK );
+
+    /* Strings are copied at the call. */
+    strcpy( name, "before" );
+    rgl_log( lg, "[%s] [%5s]\n", name, (const char*)name );
+    strcpy( name, "after" );
+
+    /* Text is truncated, and later strings are empty. */
+    memset( big, 'a', sizeof( big ) - 1 );
+    big[ sizeof( big ) - 1 ] = 0;
+    rgl_log( lg, "%s|%s|%d\n", big, "tail", 5 );
+    rgl_flush( lg );
+
+    memset( want, 0, sizeof( want ) );
+    strcpy( want, "[before] [before]\n" );
+    memset( &want[ strlen( want ) ], 'a', RGL_TEXT_MAX - 1 );
+    strcat( want, "||5\n" );
+
+    log_read( fh, buf, sizeof( buf ) );
+    TEST_ASSERT_EQUAL_STRING( want, buf );
+
+    rgl_destroy( &lg );
+    fclose( fh );
+}
+
+
+#define LOG_P10 "%%%%%%%%%%%%%%%%%%%%"
+#define LOG_P100 LOG_P10 LOG_P10 LOG_P10 LOG_P10 LOG_P10 LOG_P10 LOG_P10 LOG_P10 LOG_P10 LOG_P10
+
+
+void test_log_pieces( void )
+{
+    rgl_t lg;
+    FILE* fh;
+    char  buf[ 1024 ];
+    char  want[ 1024 ];
+    int   len;
+
+    fh = tmpfile();
+    TEST_ASSERT_NOT_NULL( fh );
+    lg = rgl_new( fileno( fh ), 16, RGL_BLOCK );
+
+    /* Each "%%" is a separate piece, more than iovecs in batch. */
+    rgl_log( lg, LOG_P100 LOG_P100 LOG_P100 "%d\n", 42 );
+    rgl_log( lg, LOG_P100 LOG_P100 LOG_P100 "\n" );
+    rgl_flush( lg );
+
+    len = 0;
+    for ( int i = 0; i < 300; i++ )
+        want[ len++ ] = '%';
+    len += sprintf( &want[ len ], "42\n" );
+    for ( int i = 0; i < 300; i++ )
+        want[ len++ ] = '%';
+    sprintf( &want[ len ], "\n" );
+
+    log_read( fh, buf, sizeof( buf ) );
+    TEST_ASSERT_EQUAL_STRING( want, buf );
+
+    rgl_destroy( &lg );
+    fclose( fh );
+}
+
+
+static void* log_other( void* arg )
+{
+    rgl_log( (rgl_t)arg, "other\n" );
+    return NULL;
+}
+
+
+void test_log_drop( void )
+{
+    rgl_t     lg;
+    int       fd[ 2 ];
+    char      buf[ 4096 ];
+    ssize_t   fill;
+    ssize_t   len;
+    int       stored;
+    pthread_t other;
+
+    struct timespec wait = { 0, 50000000 };
+
+    TEST_ASSERT_EQUAL( 0, pipe( fd ) );
+
+    /* Fill pipe, so Logger thread blocks in write. */
+    memset( buf, 'x', sizeof( buf ) );
+    fcntl( fd[ 1 ], F_SETFL, O_NONBLOCK );
+    fill = 0;
+    while ( ( len = write( fd[ 1 ], buf, sizeof( buf ) ) ) > 0 )
+        fill += len;
+    while ( ( len = write( fd[ 1 ], buf, 1 ) ) > 0 )
+        fill += len;
+    fcntl( fd[ 1 ], F_SETFL, 0 );
+
+    lg = rgl_new( fd[ 1 ], 2, RGL_DROP );
+    rgl_log( lg, "first\n" );
+
+    /* Logger thread takes the record within its idle period. */
+    nanosleep( &wait, NULL );
+
+    stored = 0;
+    for ( int i = 0; i < 10; i++ )
+        stored += rgl_log( lg, "line %d\n", i );
+
+    TEST_ASSERT_EQUAL( 2, stored );
+    TEST_ASSERT_EQUAL( 8, rgl_drops( lg ) );
+
+    /* New logging thread is not blocked by write in progress. */
+    pthread_create( &other, NULL, log_other, lg );
+    pthread_join( other, NULL );
+
+    /* Release Logger thread. */
+    while ( fill > 0 ) {
+        len = read( fd[ 0 ], buf, fill < (ssize_t)sizeof( buf ) ? fill : (ssize_t)sizeof( buf ) );
+        TEST_ASSERT( len > 0 );
+        fill -= len;
+    }
+
+    rgl_destroy( &lg );
+    close( fd[ 1 ] );
+
+    fill = 0;
+    while ( ( len = read( fd[ 0 ], &buf[ fill ], sizeof( buf ) - 1 - fill ) ) > 0 )
+        fill += len;
+    buf[ fill ] = 0;
+    close( fd[ 0 ] );
+
+    TEST_ASSERT_EQUAL_STRING( "first\nother\nline 0\nline 1\n", buf );
+}
+
+
+static rgl_t log_shared;
+
+
+static void* log_worker( void* arg )
+{
+    long id = (long)arg;
+
+    for ( int i = 0; i < LOG_LINES; i++ )
+        rgl_log( log_shared, "thread %ld line %d\n", id, i );
+
+    return NULL;
+}
+
+
+void test_log_threads( void )
+{
+    pthread_t thr[ LOG_THREADS ];
+    FILE*     fh;
+    char      line[ 64 ];
+    int       next[ LOG_THREADS ] = { 0 };
+    long      id;
+    int       num;
+    int       cnt;
+
+    fh = tmpfile();
+    TEST_ASSERT_NOT_NULL( fh );
+    log_shared = rgl_new( fileno( fh ), 64, RGL_BLOCK );
+
+    for ( long t = 0; t < LOG_THREADS; t++ )
+        pthread_create( &thr[ t ], NULL, log_worker, (void*)t );
+    for ( int t = 0; t < LOG_THREADS; t++ )
+        pthread_join( thr[ t ], NULL );
+
+    /* Exited threads are drained before release. */
+    rgl_destroy( &log_shared );
+
+    /* Lines of each thread are in order. */
+    rewind( fh );
+    cnt = 0;
+    while ( fgets( line, sizeof( line ), fh ) ) {
+        TEST_ASSERT_EQUAL( 2, sscanf( line, "thread %ld line %d", &id, &num ) );
+        TEST_ASSERT_EQUAL( next[ id ], num );
+        next[ id ]++;
+        cnt++;
+    }
+    TEST_ASSERT_EQUAL( LOG_THREADS * LOG_LINES, cnt );
+
+    fclose( fh );
+}
+
+
+void test_log_no_key( void )
+{
+    pthread_key_t keys[ PTHREAD_KEYS_MAX ];
+    int           cnt = 0;
+    rgl_t lg;
+
+    /* Creation fails cleanly when thread keys are exhausted. */
+    while ( cnt < PTHREAD_KEYS_MAX && pthread_key_create( &keys[ cnt ], NULL ) == 0 )
+        cnt++;
+    lg = rgl_new( 1, 16, RGL_BLOCK );
+    while ( cnt > 0 )
+        pthread_key_delete( keys[ --cnt ] );
+
+    TEST_ASSERT_NULL( lg );
+}
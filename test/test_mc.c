@@ -0,0 +1,155 @@
+#include <pthread.h>
+#include <sched.h>
+#include "unity.h"
+#include "ringer_mc.h"
+
+
+#define MC_ITEMS 100000
+
+
+void test_mc_basics( void )
+{
+    rgm_t m;
+    int   items[ 16 ];
+    int   a, b, c;
+    int*  item;
+
+    for ( int i = 0; i < 16; i++ )
+        items[ i ] = i;
+
+    m = rgm_new( 3 );
+    TEST_ASSERT_EQUAL( 4, rgm_size( m ) );
+
+    a = rgm_add( m, 0 );
+    b = rgm_add( m, 1 << a );
+    c = rgm_add( m, 0 );
+    TEST_ASSERT_EQUAL( 0, a );
+    TEST_ASSERT_EQUAL( 1, b );
+    TEST_ASSERT_EQUAL( 2, c );
+
+    /* Unknown dependency. */
+    TEST_ASSERT_EQUAL( -1, rgm_add( m, 1 << 5 ) );
+
+    for ( int i = 0; i < 4; i++ )
+        TEST_ASSERT_EQUAL( 1, rgm_put( m, &items[ i ] ) );
+    TEST_ASSERT_EQUAL( 0, rgm_put( m, &items[ 4 ] ) );
+
+    /* Dependent sees nothing before A releases. */
+    TEST_ASSERT_EQUAL( 4, rgm_avail( m, a ) );
+    TEST_ASSERT_EQUAL( 0, rgm_avail( m, b ) );
+    TEST_ASSERT_NULL( rgm_get( m, b ) );
+    TEST_ASSERT_EQUAL( 4, rgm_avail( m, c ) );
+
+    item = rgm_peek( m, a, 1 );
+    TEST_ASSERT_EQUAL( 1, *item );
+    rgm_release( m, a, 2 );
+    TEST_ASSERT_EQUAL( 2, rgm_avail( m, b ) );
+
+    /* Producer gated by slowest (B and C). */
+    TEST_ASSERT_EQUAL( 0, rgm_put( m, &items[ 4 ] ) );
+
+    item = rgm_get( m, b );
+    TEST_ASSERT_EQUAL( 0, *item );
+    TEST_ASSERT_EQUAL( 0, rgm_put( m, &items[ 4 ] ) );
+
+    item = rgm_get( m, c );
+    TEST_ASSERT_EQUAL( 0, *item );
+    TEST_ASSERT_EQUAL( 1, rgm_put( m, &items[ 4 ] ) );
+    TEST_ASSERT_EQUAL( 0, rgm_put( m, &items[ 5 ] ) );
+
+    /* Every consumer sees every item once, in order. */
+    for ( int i = 2; i < 5; i++ ) {
+        item = rgm_get( m, a );
+        TEST_ASSERT_EQUAL( i, *item );
+    }
+    TEST_ASSERT_NULL( rgm_get( m, a ) );
+    for ( int i = 1; i < 5; i++ ) {
+        item = rgm_get( m, b );
+        TEST_ASSERT_EQUAL( i, *item );
+        item = rgm_get( m, c );
+        TEST_ASSERT_EQUAL( i, *item );
+    }
+    TEST_ASSERT_NULL( rgm_get( m, b ) );
+    TEST_ASSERT_NULL( rgm_get( m, c ) );
+
+    rgm_destroy( &m );
+    TEST_ASSERT_NULL( m );
+}
+
+
+static rgm_t mc_shared;
+static int   mc_items[ MC_ITEMS ];
+static int   mc_seen[ MC_ITEMS ];
+
+
+struct mc_arg_s
+{
+    int  id;
+    int  check; /**< Check that dependency has processed item. */
+    long sum;
+};
+
+
+static void* mc_consumer( void* arg )
+{
+    struct mc_arg_s* a = arg;
+    rg_size_t        n;
+    int*             item;
+
+    for ( int i = 0; i < MC_ITEMS; ) {
+
+        n = rgm_avail( mc_shared, a->id );
+        if ( n == 0 ) {
+            sched_yield();
+            continue;
+        }
+
+        for ( rg_size_t j = 0; j < n; j++ ) {
+            item = rgm_peek( mc_shared, a->id, j );
+            if ( a->check ) {
+                if ( mc_seen[ *item ] != 1 )
+                    a->sum = -1000000000L;
+            } else if ( a->id == 0 ) {
+                mc_seen[ *item ] = 1;
+            }
+            a->sum += *item;
+        }
+
+        rgm_release( mc_shared, a->id, n );
+        i += n;
+    }
+
+    return NULL;
+}
+
+
+void test_mc_threads( void )
+{
+    pthread_t       thr[ 3 ];
+    struct mc_arg_s arg[ 3 ] = { { 0, 0, 0 }, { 0, 1, 0 }, { 0, 0, 0 } };
+    long            exp = 0;
+
+    mc_shared = rgm_new( 64 );
+
+    /* Journaler, replicator after journaler, and logic. */
+    arg[ 0 ].id = rgm_add( mc_shared, 0 );
+    arg[ 1 ].id = rgm_add( mc_shared, 1 << arg[ 0 ].id );
+    arg[ 2 ].id = rgm_add( mc_shared, 0 );
+
+    for ( int t = 0; t < 3; t++ )
+        pthread_create( &thr[ t ], NULL, mc_consumer, &arg[ t ] );
+
+    for ( int i = 0; i < MC_ITEMS; i++ ) {
+        mc_items[ i ] = i;
+        exp += i;
+        while ( !rgm_put( mc_shared, &mc_items[ i ] ) )
+            sched_yield();
+    }
+
+    for ( int t = 0; t < 3; t++ ) {
+        pthread_join( thr[ t ], NULL );
+        TEST_ASSERT_EQUAL( exp, arg[ t ].sum );
+    }
+
+    rgm_destroy( &mc_shared );
+}
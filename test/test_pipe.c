@@ -0,0 +1,187 @@
+#include <stdint.h>
+#include <sched.h>
+#include "unity.h"
+#include "ringer.h"
+#include "ringer_spsc.h"
+#include "ringer_pipe.h"
+
+
+#define PIPE_ITEMS 100000
+
+
+typedef struct pipe_sink_s
+{
+    rg_size_t cnt;
+    rg_size_t sum;
+    uintptr_t last;
+    int       order;
+} pipe_sink_s;
+
+
+static void* pipe_double( void* item, void* ctx )
+{
+    (void)ctx;
+    return (void*)( (uintptr_t)item * 2 );
+}
+
+
+static void* pipe_filter( void* item, void* ctx )
+{
+    (void)ctx;
+    if ( ( (uintptr_t)item / 2 ) % 3 == 0 )
+        return NULL;
+    return item;
+}
+
+
+static void* pipe_sink( void* item, void* ctx )
+{
+    pipe_sink_s* sink = ctx;
+    uintptr_t    val = (uintptr_t)item;
+
+    if ( val <= sink->last )
+        sink->order = 0;
+    sink->last = val;
+    sink->cnt++;
+    sink->sum += val;
+
+    return NULL;
+}
+
+
+void test_pipe_basics( void )
+{
+    rgpl_t       pl;
+    rgpl_stats_s st;
+    pipe_sink_s  sink = { 0, 0, 0, 1 };
+    rg_size_t    cnt = 0;
+    rg_size_t    sum = 0;
+    void*        items[ 8 ];
+    rg_size_t    n;
+    uintptr_t    next;
+
+    /* Small Ringers for backpressure. */
+    pl = rgpl_new( 16, 4 );
+    TEST_ASSERT_EQUAL( 0, rgpl_add( pl, pipe_double, NULL, RGPL_ANY_CPU ) );
+    TEST_ASSERT_EQUAL( 1, rgpl_add( pl, pipe_filter, NULL, 0 ) );
+    TEST_ASSERT_EQUAL( 2, rgpl_add( pl, pipe_sink, &sink, RGPL_ANY_CPU ) );
+    TEST_ASSERT_EQUAL( 1, rgpl_start( pl ) );
+    TEST_ASSERT_EQUAL( -1, rgpl_add( pl, pipe_sink, &sink, RGPL_ANY_CPU ) );
+
+    next = 1;
+    while ( next <= PIPE_ITEMS ) {
+        if ( next % 2 ) {
+            while ( !rgpl_push( pl, (void*)next ) )
+                sched_yield();
+            next++;
+        } else {
+            for ( n = 0; n < 8 && next + n <= PIPE_ITEMS; n++ )
+                items[ n ] = (void*)( next + n );
+            for ( rg_size_t off = 0; off < n; ) {
+                off += rgpl_push_n( pl, &items[ off ], n - off );
+                sched_yield();
+            }
+            next += n;
+        }
+    }
+
+    rgpl_stop( pl );
+
+    for ( uintptr_t i = 1; i <= PIPE_ITEMS; i++ ) {
+        if ( i % 3 ) {
+            cnt++;
+            sum += 2 * i;
+        }
+    }
+
+    TEST_ASSERT_EQUAL( cnt, sink.cnt );
+    TEST_ASSERT_EQUAL( sum, sink.sum );
+    TEST_ASSERT_EQUAL( 1, sink.order );
+
+    TEST_ASSERT_EQUAL( 1, rgpl_stats( pl, 0, &st ) );
+    TEST_ASSERT_EQUAL( PIPE_ITEMS, st.items );
+    TEST_ASSERT_EQUAL( 0, st.queued );
+    TEST_ASSERT( st.batches >= PIPE_ITEMS / 4 );
+    TEST_ASSERT( st.queued_max <= 16 );
+    TEST_ASSERT( st.rate > 0.0 );
+
+    TEST_ASSERT_EQUAL( 1, rgpl_stats( pl, 2, &st ) );
+    TEST_ASSERT_EQUAL( cnt, st.items );
+    TEST_ASSERT_EQUAL( 0, rgpl_stats( pl, 3, &st ) );
+
+    rgpl_destroy( &pl );
+    TEST_ASSERT_NULL( pl );
+}
+
+
+typedef struct pipe_feed_s
+{
+    rgpl_t pl;
+    int    left;
+} pipe_feed_s;
+
+
+static void* pipe_feed( void* item, void* ctx )
+{
+    pipe_feed_s* feed = ctx;
+
+    /* Refill own input, more than next stage can take. */
+    if ( feed->left > 0 && rgpl_push( feed->pl, item ) )
+        feed->left--;
+
+    return item;
+}
+
+
+void test_pipe_pin_fail( void )
+{
+    rgpl_t      pl;
+    pipe_sink_s sink = { 0, 0, 0, 1 };
+
+    pl = rgpl_new( 16, 0 );
+    rgpl_add( pl, pipe_double, NULL, 0 );
+    rgpl_add( pl, pipe_sink, &sink, 1 << 20 );
+    TEST_ASSERT_EQUAL( 0, rgpl_start( pl ) );
+    TEST_ASSERT_EQUAL( 0, rgpl_start( pl ) );
+
+    rgpl_destroy( &pl );
+}
+
+
+void test_pipe_pin_fail_full( void )
+{
+    rgpl_t      pl;
+    pipe_feed_s feed;
+    pipe_sink_s sink = { 0, 0, 0, 1 };
+
+    pl = rgpl_new( 16, 0 );
+    feed.pl = pl;
+    feed.left = 100;
+    rgpl_add( pl, pipe_feed, &feed, RGPL_ANY_CPU );
+    rgpl_add( pl, pipe_sink, &sink, 1 << 20 );
+    rgpl_push( pl, (void*)1 );
+
+    /* Started stage does not block on input of failed stage. */
+    TEST_ASSERT_EQUAL( 0, rgpl_start( pl ) );
+    TEST_ASSERT_EQUAL( 0, feed.left );
+    TEST_ASSERT_EQUAL( 0, sink.cnt );
+
+    rgpl_destroy( &pl );
+}
+
+
+void test_pipe_destroy_running( void )
+{
+    rgpl_t      pl;
+    pipe_sink_s sink = { 0, 0, 0, 1 };
+
+    pl = rgpl_new( 64, 0 );
+    rgpl_add( pl, pipe_sink, &sink, RGPL_ANY_CPU );
+    TEST_ASSERT_EQUAL( 1, rgpl_start( pl ) );
+    for ( uintptr_t i = 1; i <= 10; i++ )
+        rgpl_push( pl, (void*)i );
+
+    /* Destroy drains. */
+    rgpl_destroy( &pl );
+    TEST_ASSERT_EQUAL( 10, sink.cnt );
+}
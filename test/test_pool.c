@@ -0,0 +1,136 @@
+#include <limits.h>
+#include <pthread.h>
+#include <sched.h>
+#include "unity.h"
+#include "ringer.h"
+#include "ringer_spsc.h"
+#include "ringer_pool.h"
+
+
+#define POOL_OBJS   1000
+#define POOL_ROUNDS 20
+
+
+void test_pool_basics( void )
+{
+    rgp_t p;
+    void* obj[ 16 ];
+    void* again;
+
+    p = rgp_new( 64, 4 );
+    TEST_ASSERT_EQUAL( 0, rgp_allocated( p ) );
+
+    for ( int i = 0; i < 16; i++ )
+        obj[ i ] = rgp_get( p );
+    TEST_ASSERT_EQUAL( 16, rgp_allocated( p ) );
+
+    /* Two magazines in cache, the rest go to depot. */
+    for ( int i = 0; i < 16; i++ )
+        rgp_put( p, obj[ i ] );
+    TEST_ASSERT_EQUAL( 2, rg_count( p->full ) );
+
+    /* Objects are recycled, last put first. */
+    again = rgp_get( p );
+    TEST_ASSERT_EQUAL_PTR( obj[ 15 ], again );
+    for ( int i = 1; i < 16; i++ )
+        obj[ i ] = rgp_get( p );
+    TEST_ASSERT_EQUAL( 16, rgp_allocated( p ) );
+    TEST_ASSERT_EQUAL( 0, rg_count( p->full ) );
+
+    for ( int i = 1; i < 16; i++ )
+        rgp_put( p, obj[ i ] );
+    rgp_put( p, again );
+
+    /* Flush moves cache to depot. */
+    rgp_flush( p );
+    TEST_ASSERT_EQUAL( 4, rg_count( p->full ) );
+
+    rgp_destroy( &p );
+    TEST_ASSERT_NULL( p );
+}
+
+
+static rgp_t pool_shared;
+static rgs_t pool_pipe;
+static int   pool_errors;
+
+
+/* Allocates objects and passes them to consumer. */
+static void* pool_producer( void* arg )
+{
+    int* obj;
+
+    (void)arg;
+
+    for ( int r = 0; r < POOL_ROUNDS; r++ ) {
+        for ( int i = 0; i < POOL_OBJS; i++ ) {
+            obj = rgp_get( pool_shared );
+            *obj = i;
+            while ( !rgs_put( pool_pipe, obj ) )
+                sched_yield();
+        }
+    }
+
+    return NULL;
+}
+
+
+/* Releases objects, which return to producer through depot. */
+static void* pool_consumer( void* arg )
+{
+    int* obj;
+
+    (void)arg;
+
+    for ( int n = 0; n < POOL_ROUNDS * POOL_OBJS; n++ ) {
+        while ( ( obj = rgs_get( pool_pipe ) ) == NULL )
+            sched_yield();
+        if ( *obj != n % POOL_OBJS )
+            pool_errors++;
+        rgp_put( pool_shared, obj );
+    }
+
+    return NULL;
+}
+
+
+void test_pool_threads( void )
+{
+    pthread_t prod;
+    pthread_t cons;
+
+    pool_shared = rgp_new( sizeof( int ), 32 );
+    pool_pipe = rgs_new( 256 );
+
+    pthread_create( &prod, NULL, pool_producer, NULL );
+    pthread_create( &cons, NULL, pool_consumer, NULL );
+    pthread_join( prod, NULL );
+    pthread_join( cons, NULL );
+    TEST_ASSERT_EQUAL( 0, pool_errors );
+
+    /* Objects were recycled between threads. */
+    TEST_ASSERT( rgp_allocated( pool_shared ) < POOL_ROUNDS * POOL_OBJS / 4 );
+
+    /* Exited threads flushed their caches to depot. */
+    TEST_ASSERT_NULL( pool_shared->caches );
+
+    rgs_destroy( &pool_pipe );
+    rgp_destroy( &pool_shared );
+}
+
+
+void test_pool_no_key( void )
+{
+    pthread_key_t keys[ PTHREAD_KEYS_MAX ];
+    int           cnt = 0;
+    rgp_t p;
+
+    /* Creation fails cleanly when thread keys are exhausted. */
+    while ( cnt < PTHREAD_KEYS_MAX && pthread_key_create( &keys[ cnt ], NULL ) == 0 )
+        cnt++;
+    p = rgp_new( 64, 4 );
+    while ( cnt > 0 )
+        pthread_key_delete( keys[ --cnt ] );
+
+    TEST_ASSERT_NULL( p );
+}
@@ -0,0 +1,141 @@
+#include <stdint.h>
+#include "unity.h"
+#include "ringer.h"
+#include "ringer_prio.h"
+
+
+void test_prio_basics( void )
+{
+    rgpr_t pr;
+    int    lane;
+
+    TEST_ASSERT_NULL( rgpr_new( 0, 4, 0 ) );
+    TEST_ASSERT_NULL( rgpr_new( RGPR_MAX_LANES + 1, 4, 0 ) );
+    TEST_ASSERT_NULL( rgpr_new( 4, 0, 1 ) );
+    TEST_ASSERT_NULL( rgpr_new( 4, RG_MIN_SIZE - 1, 0 ) );
+
+    pr = rgpr_new( 4, 2, 0 );
+    TEST_ASSERT_EQUAL( 4, rgpr_lanes( pr ) );
+    TEST_ASSERT_EQUAL( 1, rgpr_is_empty( pr ) );
+    TEST_ASSERT_NULL( rgpr_get( pr, &lane ) );
+    TEST_ASSERT_NULL( rgpr_get_wrr( pr, &lane ) );
+    TEST_ASSERT_NULL( rgpr_peek( pr, &lane ) );
+
+    TEST_ASSERT_EQUAL( 0, rgpr_put( pr, 4, (void*)1 ) );
+    TEST_ASSERT_EQUAL( 0, rgpr_put( pr, -1, (void*)1 ) );
+
+    TEST_ASSERT_EQUAL( 1, rgpr_put( pr, 3, (void*)31 ) );
+    TEST_ASSERT_EQUAL( 1, rgpr_put( pr, 1, (void*)11 ) );
+    TEST_ASSERT_EQUAL( 1, rgpr_put( pr, 3, (void*)32 ) );
+    TEST_ASSERT_EQUAL( 0, rgpr_put( pr, 3, (void*)33 ) );
+    TEST_ASSERT_EQUAL( 1, rgpr_put( pr, 1, (void*)12 ) );
+    TEST_ASSERT_EQUAL( 4, rgpr_count( pr ) );
+    TEST_ASSERT_EQUAL( 2, rgpr_lane_count( pr, 3 ) );
+    TEST_ASSERT_EQUAL( 0, rgpr_lane_count( pr, 9 ) );
+
+    TEST_ASSERT_EQUAL( 11, (uintptr_t)rgpr_peek( pr, &lane ) );
+    TEST_ASSERT_EQUAL( 1, lane );
+
+    /* Higher priority arrives between gets. */
+    TEST_ASSERT_EQUAL( 11, (uintptr_t)rgpr_get( pr, NULL ) );
+    rgpr_put( pr, 0, (void*)1 );
+    TEST_ASSERT_EQUAL( 1, (uintptr_t)rgpr_get( pr, &lane ) );
+    TEST_ASSERT_EQUAL( 0, lane );
+    TEST_ASSERT_EQUAL( 12, (uintptr_t)rgpr_get( pr, &lane ) );
+    TEST_ASSERT_EQUAL( 1, lane );
+    TEST_ASSERT_EQUAL( 31, (uintptr_t)rgpr_get( pr, &lane ) );
+    TEST_ASSERT_EQUAL( 32, (uintptr_t)rgpr_get( pr, &lane ) );
+    TEST_ASSERT_EQUAL( 3, lane );
+    TEST_ASSERT_EQUAL( 1, rgpr_is_empty( pr ) );
+    TEST_ASSERT_EQUAL( 0, rgpr_count( pr ) );
+
+    rgpr_destroy( &pr );
+    TEST_ASSERT_NULL( pr );
+}
+
+
+void test_prio_grow( void )
+{
+    rgpr_t pr;
+
+    pr = rgpr_new( RGPR_MAX_LANES, 2, 1 );
+
+    for ( uintptr_t i = 1; i <= 100; i++ )
+        TEST_ASSERT_EQUAL( 1, rgpr_put( pr, 63, (void*)i ) );
+    TEST_ASSERT_EQUAL( 1, rgpr_put( pr, 62, (void*)1000 ) );
+
+    TEST_ASSERT_EQUAL( 1000, (uintptr_t)rgpr_get( pr, NULL ) );
+    for ( uintptr_t i = 1; i <= 100; i++ )
+        TEST_ASSERT_EQUAL( i, (uintptr_t)rgpr_get( pr, NULL ) );
+    TEST_ASSERT_EQUAL( 1, rgpr_is_empty( pr ) );
+
+    rgpr_destroy( &pr );
+}
+
+
+void test_prio_set_lane( void )
+{
+    rgpr_t pr;
+
+    pr = rgpr_new( 2, 4, 0 );
+
+    /* Lane 0 fixed and small, lane 1 grows. */
+    TEST_ASSERT_EQUAL( 1, rgpr_set_lane( pr, 0, 2, 0 ) );
+    TEST_ASSERT_EQUAL( 1, rgpr_set_lane( pr, 1, 4, 1 ) );
+    TEST_ASSERT_EQUAL( 0, rgpr_set_lane( pr, 2, 4, 1 ) );
+    TEST_ASSERT_EQUAL( 0, rgpr_set_lane( pr, 1, 0, 1 ) );
+
+    TEST_ASSERT_EQUAL( 1, rgpr_put( pr, 0, (void*)1 ) );
+    TEST_ASSERT_EQUAL( 1, rgpr_put( pr, 0, (void*)2 ) );
+    TEST_ASSERT_EQUAL( 0, rgpr_put( pr, 0, (void*)3 ) );
+
+    for ( uintptr_t i = 1; i <= 10; i++ )
+        TEST_ASSERT_EQUAL( 1, rgpr_put( pr, 1, (void*)( 10 + i ) ) );
+    TEST_ASSERT_EQUAL( 10, rgpr_lane_count( pr, 1 ) );
+
+    /* Size may not go below item count, items are kept. */
+    TEST_ASSERT_EQUAL( 0, rgpr_set_lane( pr, 0, 1, 0 ) );
+    TEST_ASSERT_EQUAL( 1, rgpr_set_lane( pr, 0, 8, 0 ) );
+    TEST_ASSERT_EQUAL( 1, rgpr_put( pr, 0, (void*)3 ) );
+    TEST_ASSERT_EQUAL( 0, rgpr_set_lane( pr, 1, 4, 0 ) );
+
+    for ( uintptr_t i = 1; i <= 3; i++ )
+        TEST_ASSERT_EQUAL( i, (uintptr_t)rgpr_get( pr, NULL ) );
+    for ( uintptr_t i = 1; i <= 10; i++ )
+        TEST_ASSERT_EQUAL( 10 + i, (uintptr_t)rgpr_get( pr, NULL ) );
+
+    rgpr_destroy( &pr );
+}
+
+
+void test_prio_wrr( void )
+{
+    rgpr_t pr;
+    int    lane;
+    int    seq[ 12 ];
+    int    want[ 12 ] = { 0, 0, 0, 1, 3, 0, 0, 0, 1, 3, 1, 1 };
+
+    pr = rgpr_new( 4, 16, 0 );
+    TEST_ASSERT_EQUAL( 0, rgpr_set_weight( pr, 0, 0 ) );
+    TEST_ASSERT_EQUAL( 1, rgpr_set_weight( pr, 0, 3 ) );
+
+    for ( uintptr_t i = 0; i < 6; i++ )
+        rgpr_put( pr, 0, (void*)( i + 1 ) );
+    for ( uintptr_t i = 0; i < 4; i++ )
+        rgpr_put( pr, 1, (void*)( i + 1 ) );
+    for ( uintptr_t i = 0; i < 2; i++ )
+        rgpr_put( pr, 3, (void*)( i + 1 ) );
+
+    /* Lane 0 gets 3 per round, others 1, and empty lanes are skipped. */
+    for ( int i = 0; i < 12; i++ ) {
+        TEST_ASSERT_NOT_NULL( rgpr_get_wrr( pr, &lane ) );
+        seq[ i ] = lane;
+    }
+    for ( int i = 0; i < 12; i++ )
+        TEST_ASSERT_EQUAL( want[ i ], seq[ i ] );
+
+    TEST_ASSERT_EQUAL( 1, rgpr_is_empty( pr ) );
+    TEST_ASSERT_NULL( rgpr_get_wrr( pr, &lane ) );
+
+    rgpr_destroy( &pr );
+}
@@ -0,0 +1,144 @@
+#include <pthread.h>
+#include <sched.h>
+#include "unity.h"
+#include "ringer_spsc.h"
+#include "ringer_shard.h"
+
+
+void test_shard_basics( void )
+{
+    rgsh_t rh;
+    int    items[ 8 ];
+    void*  batch[ 8 ];
+    int*   item;
+
+    for ( int i = 0; i < 8; i++ )
+        items[ i ] = i;
+
+    rh = rgsh_new( 3, 4, 2 );
+    TEST_ASSERT_EQUAL( 3, rgsh_shards( rh ) );
+    TEST_ASSERT_EQUAL( 1, rgsh_is_empty( rh ) );
+    TEST_ASSERT_NULL( rgsh_get( rh ) );
+
+    /* Producer may not fall back while its items are in shard. */
+    for ( int i = 0; i < 4; i++ )
+        TEST_ASSERT_EQUAL( 1, rgsh_put( rh, &items[ i ] ) );
+
+    TEST_ASSERT_EQUAL( 0, rgsh_put( rh, &items[ 0 ] ) );
+    TEST_ASSERT_EQUAL( 4, rgsh_count( rh ) );
+
+    for ( int i = 0; i < 4; i++ ) {
+        item = rgsh_get( rh );
+        TEST_ASSERT_EQUAL( i, *item );
+    }
+
+    for ( int i = 4; i < 8; i++ )
+        TEST_ASSERT_EQUAL( 1, rgsh_put( rh, &items[ i ] ) );
+
+    TEST_ASSERT_EQUAL( 4, rgsh_get_n( rh, batch, 8 ) );
+    for ( int i = 0; i < 4; i++ )
+        TEST_ASSERT_EQUAL( 4 + i, *( (int*)batch[ i ] ) );
+
+    TEST_ASSERT_EQUAL( 0, rgsh_get_n( rh, batch, 8 ) );
+
+    rgsh_destroy( &rh );
+    TEST_ASSERT_NULL( rh );
+}
+
+
+static void* shard_put_one( void* arg )
+{
+    rgsh_put( (rgsh_t)arg, arg );
+    return NULL;
+}
+
+
+void test_shard_recreate( void )
+{
+    rgsh_t    rh;
+    pthread_t thr;
+
+    /* Keys and producer states are released, also of exited threads. */
+    for ( int i = 0; i < 2000; i++ ) {
+        rh = rgsh_new( 2, 4, 0 );
+        TEST_ASSERT_NOT_NULL( rh );
+        rgsh_put( rh, rh );
+        pthread_create( &thr, NULL, shard_put_one, rh );
+        pthread_join( thr, NULL );
+        TEST_ASSERT_EQUAL( 2, rgsh_count( rh ) );
+        rgsh_destroy( &rh );
+    }
+}
+
+
+#define SHARD_PRODUCERS 4
+#define SHARD_ITEMS     50000
+
+
+struct shard_arg_s
+{
+    rgsh_t    rh;
+    uintptr_t id;
+};
+
+
+void* shard_producer( void* arg )
+{
+    struct shard_arg_s* a = arg;
+
+    for ( uintptr_t i = 0; i < SHARD_ITEMS; ) {
+        if ( rgsh_put( a->rh, (void*)( ( a->id << 32 ) | ( i + 1 ) ) ) )
+            i++;
+        else
+            sched_yield();
+    }
+
+    return NULL;
+}
+
+
+void test_shard_threads( void )
+{
+    rgsh_t             rh;
+    pthread_t          th[ SHARD_PRODUCERS ];
+    struct shard_arg_s args[ SHARD_PRODUCERS ];
+    uintptr_t          next[ SHARD_PRODUCERS ];
+    void*              batch[ 16 ];
+    rg_size_t          n;
+    rg_size_t          total;
+    int                fail;
+
+    rh = rgsh_new( 0, 32, 8 );
+
+    for ( int i = 0; i < SHARD_PRODUCERS; i++ ) {
+        next[ i ] = 1;
+        args[ i ].rh = rh;
+        args[ i ].id = i;
+        pthread_create( &th[ i ], NULL, shard_producer, &args[ i ] );
+    }
+
+    total = 0;
+    fail = 0;
+    while ( total < SHARD_PRODUCERS * SHARD_ITEMS ) {
+        n = rgsh_get_n( rh, batch, 16 );
+        for ( rg_size_t i = 0; i < n; i++ ) {
+            uintptr_t id = (uintptr_t)batch[ i ] >> 32;
+            uintptr_t seq = (uintptr_t)batch[ i ] & 0xffffffff;
+            if ( id >= SHARD_PRODUCERS || seq != next[ id ] )
+                fail++;
+            else
+                next[ id ]++;
+        }
+        total += n;
+        if ( n == 0 )
+            sched_yield();
+    }
+
+    for ( int i = 0; i < SHARD_PRODUCERS; i++ )
+        pthread_join( th[ i ], NULL );
+
+    TEST_ASSERT_EQUAL( 0, fail );
+    TEST_ASSERT_EQUAL( 1, rgsh_is_empty( rh ) );
+
+    rgsh_destroy( &rh );
+}
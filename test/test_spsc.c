@@ -0,0 +1,203 @@
+#include <pthread.h>
+#include <sched.h>
+#include "unity.h"
+#include "ringer_spsc.h"
+
+
+void test_spsc_basics( void )
+{
+    rgs_t rs;
+    int   items[ 16 ];
+    void* batch[ 16 ];
+    int*  item;
+
+    for ( int i = 0; i < 16; i++ )
+        items[ i ] = i;
+
+    rs = rgs_new( 5 );
+    TEST_ASSERT_EQUAL( 8, rgs_size( rs ) );
+    TEST_ASSERT_EQUAL( 1, rgs_is_empty( rs ) );
+    TEST_ASSERT_NULL( rgs_get( rs ) );
+    TEST_ASSERT_NULL( rgs_peek( rs ) );
+
+    for ( int i = 0; i < 8; i++ )
+        TEST_ASSERT_EQUAL( 1, rgs_put( rs, &items[ i ] ) );
+
+    TEST_ASSERT_EQUAL( 1, rgs_is_full( rs ) );
+    TEST_ASSERT_EQUAL( 0, rgs_put( rs, &items[ 8 ] ) );
+
+    for ( int i = 0; i < 5; i++ ) {
+        item = rgs_peek( rs );
+        TEST_ASSERT_EQUAL( i, *item );
+        item = rgs_get( rs );
+        TEST_ASSERT_EQUAL( i, *item );
+    }
+
+    /* Batch put over the end of storage. */
+    for ( int i = 0; i < 16; i++ )
+        batch[ i ] = &items[ 8 + i % 8 ];
+    TEST_ASSERT_EQUAL( 5, rgs_put_n( rs, batch, 16 ) );
+    TEST_ASSERT_EQUAL( 8, rgs_count( rs ) );
+
+    TEST_ASSERT_EQUAL( 6, rgs_get_n( rs, batch, 6 ) );
+    for ( int i = 0; i < 3; i++ )
+        TEST_ASSERT_EQUAL( 5 + i, *( (int*)batch[ i ] ) );
+    for ( int i = 3; i < 6; i++ )
+        TEST_ASSERT_EQUAL( 5 + i, *( (int*)batch[ i ] ) );
+
+    TEST_ASSERT_EQUAL( 2, rgs_get_n( rs, batch, 16 ) );
+    TEST_ASSERT_EQUAL( 11, *( (int*)batch[ 0 ] ) );
+    TEST_ASSERT_EQUAL( 12, *( (int*)batch[ 1 ] ) );
+    TEST_ASSERT_EQUAL( 0, rgs_get_n( rs, batch, 16 ) );
+
+    rgs_destroy( &rs );
+    TEST_ASSERT_NULL( rs );
+}
+
+
+#define SPSC_ITEMS 200000
+
+
+void* spsc_producer( void* arg )
+{
+    rgs_t     rs = arg;
+    uintptr_t i = 1;
+    void*     batch[ 7 ];
+    rg_size_t n;
+
+    while ( i <= SPSC_ITEMS ) {
+        if ( i % 3 ) {
+            if ( rgs_put( rs, (void*)i ) )
+                i++;
+            else
+                sched_yield();
+        } else {
+            for ( n = 0; n < 7 && i + n <= SPSC_ITEMS; n++ )
+                batch[ n ] = (void*)( i + n );
+            n = rgs_put_n( rs, batch, n );
+            if ( n == 0 )
+                sched_yield();
+            i += n;
+        }
+    }
+
+    return NULL;
+}
+
+
+void test_spsc_threads( void )
+{
+    rgs_t     rs;
+    pthread_t th;
+    uintptr_t next;
+    void*     batch[ 5 ];
+    rg_size_t n;
+    int       fail;
+
+    rs = rgs_new( 64 );
+    pthread_create( &th, NULL, spsc_producer, rs );
+
+    next = 1;
+    fail = 0;
+    while ( next <= SPSC_ITEMS ) {
+        n = rgs_get_n( rs, batch, 5 );
+        if ( n == 0 )
+            sched_yield();
+        for ( rg_size_t i = 0; i < n; i++ ) {
+            if ( (uintptr_t)batch[ i ] != next )
+                fail++;
+            next++;
+        }
+    }
+
+    pthread_join( th, NULL );
+
+    TEST_ASSERT_EQUAL( 0, fail );
+    TEST_ASSERT_EQUAL( 1, rgs_is_empty( rs ) );
+
+    rgs_destroy( &rs );
+}
+
+
+static atomic_int spsc_done;
+static int        spsc_bad;
+static int        spsc_snaps;
+
+
+/* Check that snapshots are runs of consecutive items. */
+void* spsc_monitor( void* arg )
+{
+    rgs_t     rs = arg;
+    void*     out[ 64 ];
+    rg_size_t n;
+
+    while ( !atomic_load( &spsc_done ) ) {
+        n = rgs_snapshot( rs, out, 64 );
+        for ( rg_size_t i = 1; i < n; i++ )
+            if ( (uintptr_t)out[ i ] != (uintptr_t)out[ i - 1 ] + 1 )
+                spsc_bad++;
+        if ( n > 0 )
+            spsc_snaps++;
+        sched_yield();
+    }
+
+    return NULL;
+}
+
+
+void test_spsc_snapshot( void )
+{
+    rgs_t     rs;
+    pthread_t prod;
+    pthread_t mon;
+    uintptr_t next;
+    void*     item;
+    void*     out[ 16 ];
+
+    rs = rgs_new( 16 );
+
+    /* Wrapped content, and limit. */
+    for ( uintptr_t i = 1; i <= 10; i++ )
+        rgs_put( rs, (void*)i );
+    for ( int i = 0; i < 10; i++ )
+        rgs_get( rs );
+    for ( uintptr_t i = 1; i <= 12; i++ )
+        rgs_put( rs, (void*)i );
+    TEST_ASSERT_EQUAL( 12, rgs_snapshot( rs, out, 16 ) );
+    for ( int i = 0; i < 12; i++ )
+        TEST_ASSERT_EQUAL( i + 1, (uintptr_t)out[ i ] );
+    TEST_ASSERT_EQUAL( 4, rgs_snapshot( rs, out, 4 ) );
+    TEST_ASSERT_EQUAL( 1, (uintptr_t)out[ 0 ] );
+    TEST_ASSERT_EQUAL( 12, rgs_count( rs ) );
+    while ( rgs_get( rs ) )
+        ;
+
+    /* Snapshots while producer and consumer run. */
+    rgs_destroy( &rs );
+    rs = rgs_new( 64 );
+    atomic_store( &spsc_done, 0 );
+    spsc_bad = 0;
+    spsc_snaps = 0;
+
+    pthread_create( &prod, NULL, spsc_producer, rs );
+    pthread_create( &mon, NULL, spsc_monitor, rs );
+
+    next = 1;
+    while ( next <= SPSC_ITEMS ) {
+        if ( ( item = rgs_get( rs ) ) ) {
+            TEST_ASSERT_EQUAL( next, (uintptr_t)item );
+            next++;
+        } else {
+            sched_yield();
+        }
+    }
+
+    pthread_join( prod, NULL );
+    atomic_store( &spsc_done, 1 );
+    pthread_join( mon, NULL );
+
+    TEST_ASSERT_EQUAL( 0, spsc_bad );
+    TEST_ASSERT( spsc_snaps > 0 );
+
+    rgs_destroy( &rs );
+}
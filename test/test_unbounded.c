@@ -0,0 +1,201 @@
+#include <limits.h>
+#include <pthread.h>
+#include <sched.h>
+#include "unity.h"
+#include "ringer_unbounded.h"
+
+
+void test_unbounded_basics( void )
+{
+    rgu_t ru;
+    int   items[ 32 ];
+    int*  item;
+    int   grown;
+
+    for ( int i = 0; i < 32; i++ )
+        items[ i ] = i;
+
+    ru = rgu_new( 3 );
+    TEST_ASSERT_EQUAL( 4, rgu_size( ru ) );
+    TEST_ASSERT_NULL( rgu_get( ru ) );
+
+    grown = 0;
+    for ( int i = 0; i < 20; i++ )
+        grown += rgu_put( ru, &items[ i ] );
+
+    TEST_ASSERT_EQUAL( 2, grown );
+    TEST_ASSERT_EQUAL( 16, rgu_size( ru ) );
+
+    for ( int i = 0; i < 10; i++ ) {
+        item = rgu_get( ru );
+        TEST_ASSERT_EQUAL( i, *item );
+    }
+
+    for ( int i = 20; i < 32; i++ )
+        rgu_put( ru, &items[ i ] );
+    TEST_ASSERT_EQUAL( 32, rgu_size( ru ) );
+
+    for ( int i = 10; i < 32; i++ ) {
+        item = rgu_get( ru );
+        TEST_ASSERT_EQUAL( i, *item );
+    }
+
+    TEST_ASSERT_NULL( rgu_get( ru ) );
+
+    rgu_destroy( &ru );
+    TEST_ASSERT_NULL( ru );
+}
+
+
+#define UNBOUNDED_THREADS 3
+#define UNBOUNDED_ITEMS   100000
+
+
+struct unbounded_arg_s
+{
+    rgu_t     ru;
+    uintptr_t id;
+    int       fail;
+    _Atomic int* total;
+    int*      seen;
+};
+
+
+void* unbounded_producer( void* arg )
+{
+    struct unbounded_arg_s* a = arg;
+
+    for ( uintptr_t i = 1; i <= UNBOUNDED_ITEMS; i++ ) {
+        rgu_put( a->ru, (void*)( ( a->id << 32 ) | i ) );
+        if ( ( i & 0xff ) == 0 )
+            sched_yield();
+    }
+
+    return NULL;
+}
+
+
+void* unbounded_consumer( void* arg )
+{
+    struct unbounded_arg_s* a = arg;
+    uintptr_t               last[ UNBOUNDED_THREADS ] = { 0 };
+    void*                   item;
+
+    while ( atomic_load( a->total ) < UNBOUNDED_THREADS * UNBOUNDED_ITEMS ) {
+        item = rgu_get( a->ru );
+        if ( item == NULL ) {
+            sched_yield();
+            continue;
+        }
+        uintptr_t id = (uintptr_t)item >> 32;
+        uintptr_t seq = (uintptr_t)item & 0xffffffff;
+        /* Order per producer is kept for each consumer. */
+        if ( id >= UNBOUNDED_THREADS || seq <= last[ id ] )
+            a->fail++;
+        else
+            last[ id ] = seq;
+        a->seen[ id * UNBOUNDED_ITEMS + seq - 1 ]++;
+        atomic_fetch_add( a->total, 1 );
+    }
+
+    return NULL;
+}
+
+
+void test_unbounded_threads( void )
+{
+    rgu_t                  ru;
+    pthread_t              prod[ UNBOUNDED_THREADS ];
+    pthread_t              cons[ UNBOUNDED_THREADS ];
+    struct unbounded_arg_s pargs[ UNBOUNDED_THREADS ];
+    struct unbounded_arg_s cargs[ UNBOUNDED_THREADS ];
+    _Atomic int            total = 0;
+    static int             seen[ UNBOUNDED_THREADS * UNBOUNDED_ITEMS ];
+    int                    fail;
+
+    ru = rgu_new( 2 );
+
+    for ( int i = 0; i < UNBOUNDED_THREADS; i++ ) {
+        pargs[ i ].ru = ru;
+        pargs[ i ].id = i;
+        cargs[ i ].ru = ru;
+        cargs[ i ].fail = 0;
+        cargs[ i ].total = &total;
+        cargs[ i ].seen = seen;
+        pthread_create( &cons[ i ], NULL, unbounded_consumer, &cargs[ i ] );
+        pthread_create( &prod[ i ], NULL, unbounded_producer, &pargs[ i ] );
+    }
+
+    for ( int i = 0; i < UNBOUNDED_THREADS; i++ ) {
+        pthread_join( prod[ i ], NULL );
+        pthread_join( cons[ i ], NULL );
+    }
+
+    fail = 0;
+    for ( int i = 0; i < UNBOUNDED_THREADS; i++ )
+        fail += cargs[ i ].fail;
+    for ( int i = 0; i < UNBOUNDED_THREADS * UNBOUNDED_ITEMS; i++ ) {
+        if ( seen[ i ] != 1 )
+            fail++;
+    }
+
+    TEST_ASSERT_EQUAL( 0, fail );
+    TEST_ASSERT_NULL( rgu_get( ru ) );
+
+    rgu_destroy( &ru );
+}
+
+
+void* unbounded_worker( void* arg )
+{
+    rgu_t ru = arg;
+    int   fail = 0;
+
+    for ( uintptr_t i = 1; i <= 1000; i++ )
+        rgu_put( ru, (void*)i );
+    for ( uintptr_t i = 1; i <= 1000; i++ ) {
+        if ( rgu_get( ru ) != (void*)i )
+            fail = 1;
+    }
+
+    return fail ? arg : NULL;
+}
+
+
+void test_unbounded_exit( void )
+{
+    rgu_t     ru;
+    pthread_t th;
+    void*     ret;
+
+    ru = rgu_new( 4 );
+
+    /* Records of exited threads are reused by later threads. */
+    for ( int i = 0; i < 8; i++ ) {
+        pthread_create( &th, NULL, unbounded_worker, ru );
+        pthread_join( th, &ret );
+        TEST_ASSERT_NULL( ret );
+    }
+
+    TEST_ASSERT_NULL( rgu_get( ru ) );
+    TEST_ASSERT_EQUAL( 1024, rgu_size( ru ) );
+
+    rgu_destroy( &ru );
+}
+
+
+void test_unbounded_no_key( void )
+{
+    pthread_key_t keys[ PTHREAD_KEYS_MAX ];
+    int           cnt = 0;
+    rgu_t ru;
+
+    /* Creation fails cleanly when thread keys are exhausted. */
+    while ( cnt < PTHREAD_KEYS_MAX && pthread_key_create( &keys[ cnt ], NULL ) == 0 )
+        cnt++;
+    ru = rgu_new( 4 );
+    while ( cnt > 0 )
+        pthread_key_delete( keys[ --cnt ] );
+
+    TEST_ASSERT_NULL( ru );
+}